@@ -5,39 +5,71 @@
 //
 // Changelog:
 //      2022.08.07 Initial version
+//      2026.10.19 Multiple files hashed in parallel (`-j N` option).
 ////////////////////////////////////////////////////////////////////////////////
 #include "pfs/filesystem.hpp"
 #include "pfs/sha256.hpp"
 #include "pfs/stopwatch.hpp"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace fs = pfs::filesystem;
 
+static void print_usage (char const * program)
+{
+    std::cerr << "Usage: `" << program << " [-j N] <file>...`\n"
+        << "    -j N  hash files using N threads (0 - number of hardware threads, default is 1)\n";
+}
+
 int main (int argc, char * argv[])
 {
-    if (argc < 2) {
-        std::cerr << "Too few arguments"
-            << "\nRun `" << argv[0] << " <file>`\n";
-        return EXIT_FAILURE;
-    }
+    unsigned nthreads = 1;
+    std::vector<fs::path> paths;
 
-    auto path = pfs::utf8_decode_path(argv[1]);
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "-j") == 0) {
+            if (i + 1 >= argc) {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
 
-    if (!fs::exists(path)) {
-        std::cerr << "File not found: " << pfs::utf8_encode_path(path) << "\n";
+            nthreads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            paths.push_back(pfs::utf8_decode_path(argv[i]));
+        }
+    }
+
+    if (paths.empty()) {
+        std::cerr << "Too few arguments\n";
+        print_usage(argv[0]);
         return EXIT_FAILURE;
     }
 
     pfs::stopwatch<> sw;
+    std::vector<std::error_code> errors;
 
     sw.start();
 
-    auto digest = pfs::crypto::sha256::digest(path);
+    auto digests = pfs::crypto::sha256::digest_files(paths, errors, nthreads);
 
     sw.stop();
 
-    std::cout << to_string(digest) << " in " << sw.count() << " microseconds ("
+    int status = EXIT_SUCCESS;
+
+    for (std::size_t i = 0; i < paths.size(); i++) {
+        if (errors[i]) {
+            std::cerr << pfs::utf8_encode_path(paths[i]) << ": " << errors[i].message() << "\n";
+            status = EXIT_FAILURE;
+        } else {
+            std::cout << to_string(digests[i]) << "  " << pfs::utf8_encode_path(paths[i]) << "\n";
+        }
+    }
+
+    std::cerr << paths.size() << " file(s) in " << sw.count() << " microseconds ("
         << static_cast<double>(sw.count()) / 1000.0 / 1000.0 << " seconds)\n";
 
-    return EXIT_SUCCESS;
+    return status;
 }
@@ -293,6 +293,8 @@ public:
         inlen -= 64 - r;
 
         while (inlen >= 64) {
+            // NOTE: transform() processes the internal buffer only
+            std::memcpy(& _buf[0], in, 64);
             transform(& tmp32[0], & tmp32[64]);
             in += 64;
             inlen -= 64;
@@ -0,0 +1,330 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "binary_istream.hpp"
+#include "binary_ostream.hpp"
+#include "endian.hpp"
+#include "namespace.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+PFS__NAMESPACE_BEGIN
+
+namespace details {
+
+template <typename T>
+struct is_binary_scalar : std::integral_constant<bool
+    , std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+
+template <typename ...Ts>
+struct binary_fields_traits;
+
+template <>
+struct binary_fields_traits<>
+{
+    static constexpr bool all_scalar = true;
+    static constexpr bool all_bytes = true;
+    static constexpr std::size_t size = 0;
+};
+
+template <typename T, typename ...Ts>
+struct binary_fields_traits<T, Ts...>
+{
+    static constexpr bool all_scalar = is_binary_scalar<T>::value
+        && binary_fields_traits<Ts...>::all_scalar;
+    static constexpr bool all_bytes = sizeof(T) == 1 && binary_fields_traits<Ts...>::all_bytes;
+    static constexpr std::size_t size = sizeof(T) + binary_fields_traits<Ts...>::size;
+};
+
+/**
+ * Checks if the object of type @a T can be written/read as is: all fields are scalars,
+ * there is no padding and no byte order conversion is required. Additionally fields must follow
+ * in declaration order (see fields_contiguous()).
+ */
+template <endian Endianess, typename T, typename ...Fs>
+struct binary_fields_memcpy : std::integral_constant<bool
+    , binary_fields_traits<Fs...>::all_scalar
+        && std::is_trivially_copyable<T>::value
+        && binary_fields_traits<Fs...>::size == sizeof(T)
+        && (Endianess == endian::native || binary_fields_traits<Fs...>::all_bytes)> {};
+
+/**
+ * Checks fields are listed in declaration order. Result is known to the compiler, so the
+ * check is eliminated in optimized builds.
+ */
+inline bool fields_contiguous (char const *)
+{
+    return true;
+}
+
+template <typename F, typename ...Fs>
+inline bool fields_contiguous (char const * p, F const & f, Fs const &... fields)
+{
+    return reinterpret_cast<char const *>(& f) == p && fields_contiguous(p + sizeof(F), fields...);
+}
+
+// Scalar encoding below must produce the same bytes as pack()/unpack() for binary_ostream and
+// binary_istream respectively.
+
+template <endian Endianess, typename T>
+inline typename std::enable_if<std::is_integral<T>::value, void>::type
+encode_scalar (char * p, T const & v)
+{
+    T x = Endianess == endian::network ? to_network_order(v) : v;
+    std::memcpy(p, & x, sizeof(T));
+}
+
+template <endian Endianess, typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, void>::type
+encode_scalar (char * p, T const & v)
+{
+    using int_type = typename std::conditional<sizeof(T) == sizeof(std::uint32_t)
+        , std::uint32_t, std::uint64_t>::type;
+    static_assert(sizeof(T) == sizeof(int_type), "Unsupported floating point type");
+
+    int_type x;
+    std::memcpy(& x, & v, sizeof(T));
+    encode_scalar<Endianess>(p, x);
+}
+
+template <endian Endianess, typename T>
+inline typename std::enable_if<std::is_enum<T>::value, void>::type
+encode_scalar (char * p, T const & v)
+{
+    encode_scalar<Endianess>(p, static_cast<typename std::underlying_type<T>::type>(v));
+}
+
+template <endian Endianess, typename T>
+inline typename std::enable_if<std::is_integral<T>::value, void>::type
+decode_scalar (char const * p, T & v)
+{
+    T x;
+    std::memcpy(& x, p, sizeof(T));
+    v = Endianess == endian::network ? to_native_order(x) : x;
+}
+
+template <endian Endianess, typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, void>::type
+decode_scalar (char const * p, T & v)
+{
+    using int_type = typename std::conditional<sizeof(T) == sizeof(std::uint32_t)
+        , std::uint32_t, std::uint64_t>::type;
+    static_assert(sizeof(T) == sizeof(int_type), "Unsupported floating point type");
+
+    int_type x;
+    decode_scalar<Endianess>(p, x);
+    std::memcpy(& v, & x, sizeof(T));
+}
+
+template <endian Endianess, typename T>
+inline typename std::enable_if<std::is_enum<T>::value, void>::type
+decode_scalar (char const * p, T & v)
+{
+    typename std::underlying_type<T>::type x;
+    decode_scalar<Endianess>(p, x);
+    v = static_cast<T>(x);
+}
+
+template <endian Endianess>
+inline void encode_scalars (char *)
+{}
+
+template <endian Endianess, typename F, typename ...Fs>
+inline void encode_scalars (char * p, F const & f, Fs const &... fields)
+{
+    encode_scalar<Endianess>(p, f);
+    encode_scalars<Endianess>(p + sizeof(F), fields...);
+}
+
+template <endian Endianess>
+inline void decode_scalars (char const *)
+{}
+
+template <endian Endianess, typename F, typename ...Fs>
+inline void decode_scalars (char const * p, F & f, Fs &... fields)
+{
+    decode_scalar<Endianess>(p, f);
+    decode_scalars<Endianess>(p + sizeof(F), fields...);
+}
+
+template <typename OStream>
+inline void pack_each (OStream &)
+{}
+
+template <typename OStream, typename F, typename ...Fs>
+inline void pack_each (OStream & out, F const & f, Fs const &... fields)
+{
+    out << f;
+    pack_each(out, fields...);
+}
+
+template <typename IStream>
+inline void unpack_each (IStream &)
+{}
+
+template <typename IStream, typename F, typename ...Fs>
+inline void unpack_each (IStream & in, F & f, Fs &... fields)
+{
+    in >> f;
+    unpack_each(in, fields...);
+}
+
+template <bool AllScalar>
+struct binary_fields_packer;
+
+/**
+ * All fields are scalars: fields are encoded into the local buffer and written at once.
+ */
+template <>
+struct binary_fields_packer<true>
+{
+    template <endian Endianess, typename Archive, typename T, typename ...Fs>
+    static void pack (binary_ostream<Endianess, Archive> & out, T const & v, Fs const &... fields)
+    {
+        if (binary_fields_memcpy<Endianess, T, Fs...>::value
+                && fields_contiguous(reinterpret_cast<char const *>(& v), fields...)) {
+            out.write(reinterpret_cast<char const *>(& v), sizeof(T));
+            return;
+        }
+
+        char buf[binary_fields_traits<Fs...>::size];
+        encode_scalars<Endianess>(buf, fields...);
+        out.write(buf, sizeof(buf));
+    }
+
+    template <endian Endianess, typename Source, typename T, typename ...Fs>
+    static void unpack (binary_istream<Endianess, Source> & in, T & v, Fs &... fields)
+    {
+        if (binary_fields_memcpy<Endianess, T, Fs...>::value
+                && fields_contiguous(reinterpret_cast<char const *>(& v), fields...)) {
+            in.read(reinterpret_cast<char *>(& v), sizeof(T));
+            return;
+        }
+
+        char buf[binary_fields_traits<Fs...>::size];
+
+        if (in.read(buf, sizeof(buf)).is_good())
+            decode_scalars<Endianess>(buf, fields...);
+    }
+};
+
+/**
+ * Generic case: fields are written/read one by one.
+ */
+template <>
+struct binary_fields_packer<false>
+{
+    template <endian Endianess, typename Archive, typename T, typename ...Fs>
+    static void pack (binary_ostream<Endianess, Archive> & out, T const &, Fs const &... fields)
+    {
+        pack_each(out, fields...);
+    }
+
+    template <endian Endianess, typename Source, typename T, typename ...Fs>
+    static void unpack (binary_istream<Endianess, Source> & in, T &, Fs &... fields)
+    {
+        unpack_each(in, fields...);
+    }
+};
+
+template <endian Endianess, typename Archive, typename T, typename ...Fs>
+inline void pack_fields (binary_ostream<Endianess, Archive> & out, T const & v, Fs const &... fields)
+{
+    binary_fields_packer<binary_fields_traits<Fs...>::all_scalar>::pack(out, v, fields...);
+}
+
+template <endian Endianess, typename Source, typename T, typename ...Fs>
+inline void unpack_fields (binary_istream<Endianess, Source> & in, T & v, Fs &... fields)
+{
+    binary_fields_packer<binary_fields_traits<Fs...>::all_scalar>::unpack(in, v, fields...);
+}
+
+} // namespace details
+
+PFS__NAMESPACE_END
+
+#define PFS__BINARY_FIELDS_EXPAND(x) x
+#define PFS__BINARY_FIELDS_CAT(a, b) PFS__BINARY_FIELDS_CAT_(a, b)
+#define PFS__BINARY_FIELDS_CAT_(a, b) a##b
+#define PFS__BINARY_FIELDS_NARG(...) \
+    PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_NARG_(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define PFS__BINARY_FIELDS_NARG_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+
+#define PFS__BINARY_FIELDS_OF_1(v, f) v.f
+#define PFS__BINARY_FIELDS_OF_2(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_1(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_3(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_2(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_4(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_3(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_5(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_4(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_6(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_5(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_7(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_6(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_8(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_7(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_9(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_8(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_10(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_9(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_11(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_10(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_12(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_11(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_13(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_12(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_14(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_13(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_15(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_14(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_16(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_15(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_17(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_16(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_18(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_17(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_19(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_18(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_20(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_19(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_21(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_20(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_22(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_21(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_23(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_22(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_24(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_23(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_25(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_24(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_26(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_25(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_27(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_26(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_28(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_27(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_29(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_28(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_30(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_29(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_31(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_30(v, __VA_ARGS__))
+#define PFS__BINARY_FIELDS_OF_32(v, f, ...) v.f, PFS__BINARY_FIELDS_EXPAND(PFS__BINARY_FIELDS_OF_31(v, __VA_ARGS__))
+
+#define PFS__BINARY_FIELDS_OF(v, ...) PFS__BINARY_FIELDS_EXPAND( \
+    PFS__BINARY_FIELDS_CAT(PFS__BINARY_FIELDS_OF_, PFS__BINARY_FIELDS_NARG(__VA_ARGS__))(v, __VA_ARGS__))
+
+/**
+ * Generates pack() and unpack() functions for the structure @a T serializing the listed fields
+ * (up to 32) in the specified order. Must be used in the namespace of @a T (functions are found
+ * by argument-dependent lookup), fields must be accessible.
+ *
+ * If all fields are scalars (arithmetic or enumeration types) they are encoded into a local buffer
+ * and written/read at once. Moreover if the structure has no padding, the fields are listed
+ * in declaration order and byte order conversion is not required, the whole structure is copied
+ * with single write/read.
+ *
+ * @code
+ * namespace ns {
+ * struct header
+ * {
+ *     std::uint16_t type;
+ *     std::uint16_t flags;
+ *     std::uint32_t length;
+ * };
+ *
+ * PFS_BINARY_FIELDS(header, type, flags, length)
+ * } // namespace ns
+ * @endcode
+ */
+#define PFS_BINARY_FIELDS(T, ...)                                                                   \
+    template <PFS__NAMESPACE_NAME::endian Endianess, typename Archive>                              \
+    inline void pack (PFS__NAMESPACE_NAME::binary_ostream<Endianess, Archive> & out, T const & v)   \
+    {                                                                                               \
+        PFS__NAMESPACE_NAME::details::pack_fields(out, v, PFS__BINARY_FIELDS_OF(v, __VA_ARGS__));   \
+    }                                                                                               \
+                                                                                                    \
+    template <PFS__NAMESPACE_NAME::endian Endianess, typename Source>                               \
+    inline void unpack (PFS__NAMESPACE_NAME::binary_istream<Endianess, Source> & in, T & v)         \
+    {                                                                                               \
+        PFS__NAMESPACE_NAME::details::unpack_fields(in, v, PFS__BINARY_FIELDS_OF(v, __VA_ARGS__));  \
+    }
@@ -10,8 +10,11 @@
 //                 Refactored.
 //      2025.08.07 v2 is default implementation now.
 //      2025.08.12 Moved from `v2` namespace.
+//      2026.10.19 Added streamed (buffered) source support.
+//      2026.10.19 Transaction checkpoints are stored inline (std::stack replaced).
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include "assert.hpp"
 #include "error.hpp"
 #include "endian.hpp"
 #include "namespace.hpp"
@@ -19,26 +22,221 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
-#include <stack>
+#include <system_error>
 #include <utility>
 #include <vector>
 
+// Number of nested transactions that do not require heap allocation
+#ifndef PFS__BINARY_ISTREAM_INLINE_CHECKPOINTS
+#   define PFS__BINARY_ISTREAM_INLINE_CHECKPOINTS 4
+#endif
+
 PFS__NAMESPACE_BEGIN
 
 template <typename Container>
 void append_bytes (Container & c, char const * data, std::size_t n);
 
+namespace details {
+
+/**
+ * Stack of transaction checkpoints. First @a N checkpoints are stored inline, so the common
+ * case of a few nested transactions does not allocate. Deeper checkpoints are stored in the heap.
+ */
+template <typename T, std::size_t N>
+class checkpoint_stack
+{
+    static_assert(N > 0, "Expected at least one inline checkpoint");
+
+    std::array<T, N> _inline;
+    std::vector<T> _overflow;
+    std::size_t _size {0};
+
+public:
+    bool empty () const noexcept
+    {
+        return _size == 0;
+    }
+
+    std::size_t size () const noexcept
+    {
+        return _size;
+    }
+
+    void push (T const & value)
+    {
+        if (_size < N)
+            _inline[_size] = value;
+        else
+            _overflow.push_back(value);
+
+        ++_size;
+    }
+
+    void pop () noexcept
+    {
+        PFS__ASSERT(_size > 0, "checkpoint stack is empty");
+
+        if (_size > N)
+            _overflow.pop_back();
+
+        --_size;
+    }
+
+    T const & top () const noexcept
+    {
+        return _size > N ? _overflow.back() : _inline[_size - 1];
+    }
+
+    /**
+     * Returns the oldest checkpoint.
+     */
+    T const & bottom () const noexcept
+    {
+        return _inline[0];
+    }
+};
+
+/**
+ * Input buffer for the streamed source. Holds the data from the oldest transaction checkpoint
+ * (or from the current position if there is no active transaction) up to the end of data read
+ * from the source. The buffer grows only when a single read or transaction does not fit into it,
+ * so decoding is performed in bounded memory.
+ *
+ * @a Source requirements:
+ *      std::size_t read (char * buf, std::size_t n, std::error_code & ec);
+ * must read up to @a n bytes into @a buf and return the number of bytes read, zero means the end
+ * of data (or failure, in which case @a ec is set).
+ */
+template <typename Source>
+class binary_istream_buffer
+{
+public:
+    using source_type = Source;
+
+private:
+    Source _source;
+    std::vector<char> _buf;
+    bool _exhausted {false};
+    std::error_code _ec;
+
+public:
+    binary_istream_buffer (Source && source, std::size_t buffer_size)
+        : _source(std::move(source))
+        , _buf(buffer_size > 0 ? buffer_size : 1)
+    {}
+
+    Source & source () noexcept
+    {
+        return _source;
+    }
+
+    bool exhausted () const noexcept
+    {
+        return _exhausted;
+    }
+
+    std::error_code const & source_error () const noexcept
+    {
+        return _ec;
+    }
+
+    /**
+     * Refills buffer so that at least @a n bytes are available starting from @a p.
+     * Bytes starting from @a keep (@a keep <= @a p) are preserved, @a origin is the buffer
+     * start pointer, all pointers are updated accordingly, @a origin_pos is the absolute
+     * position of the @a origin in the source.
+     *
+     * @return @c true if requested bytes are available.
+     */
+    bool refill (std::size_t n, char const * keep, char const * & origin, std::size_t & origin_pos
+        , char const * & p, char const * & end)
+    {
+        auto offset = static_cast<std::size_t>(p - keep);
+        auto tail = static_cast<std::size_t>(end - keep);
+
+        if (_buf.size() < offset + n) {
+            std::vector<char> buf((std::max)(offset + n, _buf.size() * 2));
+
+            if (tail > 0)
+                std::memcpy(buf.data(), keep, tail);
+
+            _buf.swap(buf);
+        } else if (keep != _buf.data() && tail > 0) {
+            std::memmove(_buf.data(), keep, tail);
+        }
+
+        origin_pos += static_cast<std::size_t>(keep - origin);
+        origin = _buf.data();
+        p = origin + offset;
+        end = origin + tail;
+
+        auto last = _buf.data() + _buf.size();
+
+        while (!_exhausted && static_cast<std::size_t>(end - p) < n) {
+            auto n_read = _source.read(_buf.data() + tail, static_cast<std::size_t>(last - end), _ec);
+
+            if (n_read == 0) {
+                _exhausted = true;
+                break;
+            }
+
+            tail += n_read;
+            end += n_read;
+        }
+
+        return static_cast<std::size_t>(end - p) >= n;
+    }
+};
+
+/**
+ * Memory (non-streamed) source: all data is already available.
+ */
+template <>
+class binary_istream_buffer<void>
+{
+public:
+    struct source_type {};
+
+public:
+    bool exhausted () const noexcept
+    {
+        return true;
+    }
+
+    std::error_code source_error () const noexcept
+    {
+        return std::error_code{};
+    }
+
+    bool refill (std::size_t, char const *, char const * &, std::size_t &
+        , char const * &, char const * &) noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace details
+
 /**
  * No-throw version of @c binary_istream class.
+ *
+ * If @a Source is @c void the stream reads data from the memory range specified in the
+ * constructor. Otherwise the data is read from the @a Source through the internal buffer
+ * which is refilled on demand (see binary_istream_source.hpp for available sources).
+ * Transactions are supported for both kinds of streams: the streamed one keeps the data
+ * starting from the oldest active transaction in the buffer.
  */
-template <endian Endianess = endian::native>
+template <endian Endianess = endian::native, typename Source = void>
 class binary_istream
 {
     using view_type = std::pair<char const *, std::size_t>;
+    using buffer_type = details::binary_istream_buffer<Source>;
 
 public:
     using size_type = std::uint32_t;
+    using source_type = typename buffer_type::source_type;
 
     enum status_enum {
           good
@@ -46,17 +244,29 @@ public:
         , corrupted
     };
 
+    static constexpr std::size_t default_buffer_size = 64 * 1024;
+
 private:
     char const * _p {nullptr};
     char const * _end {nullptr};
     status_enum _state {status_enum::good};
-    std::stack<std::pair<status_enum, char const *>> _state_stack;
+
+    // Buffer start and its absolute position in the source. Transaction checkpoints store
+    // absolute positions since the streamed buffer can be moved while refilling.
+    char const * _origin {nullptr};
+    std::size_t _origin_pos {0};
+    details::checkpoint_stack<std::pair<status_enum, std::size_t>
+        , PFS__BINARY_ISTREAM_INLINE_CHECKPOINTS> _state_stack;
+    buffer_type _buffer;
 
 public:
     binary_istream (char const * begin, char const * end)
         : _p(begin)
         , _end(end)
+        , _origin(begin)
     {
+        static_assert(std::is_void<Source>::value, "Expected memory (non-streamed) binary_istream");
+
         if (_p == nullptr || _end == nullptr)
             throw error {make_error_code(std::errc::invalid_argument)};
 
@@ -67,11 +277,24 @@ public:
     binary_istream (char const * begin, std::size_t size)
         : _p(begin)
         , _end(begin + numeric_cast<size_type>(size))
+        , _origin(begin)
     {
+        static_assert(std::is_void<Source>::value, "Expected memory (non-streamed) binary_istream");
+
         if (_p == nullptr)
             throw error {make_error_code(std::errc::invalid_argument)};
     }
 
+    /**
+     * Constructs streamed binary_istream.
+     *
+     * @param source Data source.
+     * @param buffer_size Initial size of the internal buffer.
+     */
+    explicit binary_istream (source_type source, std::size_t buffer_size = default_buffer_size)
+        : _buffer(std::move(source), buffer_size)
+    {}
+
     binary_istream (binary_istream const &) = delete;
     binary_istream (binary_istream && other) = delete;
     binary_istream & operator = (binary_istream && other) = delete;
@@ -82,9 +305,13 @@ public:
         return _p;
     }
 
+    /**
+     * For streamed source returns @c true if there are no buffered data and the source reported
+     * the end of data.
+     */
     bool at_end () const noexcept
     {
-        return _p == _end;
+        return _p == _end && _buffer.exhausted();
     }
 
     /**
@@ -92,7 +319,7 @@ public:
      */
     bool empty () const noexcept
     {
-        return _p == _end;
+        return at_end();
     }
 
     bool is_good () const noexcept
@@ -105,18 +332,30 @@ public:
         return !this->empty() && _state == good;
     }
 
+    /**
+     * Returns number of bytes available without reading from the source (for streamed source it is
+     * the number of buffered bytes).
+     */
     size_type available () const noexcept
     {
         return numeric_cast<size_type>(_end - _p);
     }
 
+    /**
+     * Returns the error reported by the streamed source (always success for the memory stream).
+     */
+    std::error_code source_error () const noexcept
+    {
+        return _buffer.source_error();
+    }
+
     /**
      * Skips @a nbytes in stream.
      */
     void skip (size_type nbytes)
     {
         if (_state == status_enum::good) {
-            if (this->_p + nbytes <= this->_end) {
+            if (nbytes <= available() || refill(nbytes)) {
                 this->_p += nbytes;
             } else {
                 _state = status_enum::out_of_bound;
@@ -164,7 +403,7 @@ public:
 
     void start_transaction ()
     {
-        _state_stack.push(std::make_pair(_state, _p));
+        _state_stack.push(std::make_pair(_state, position()));
     }
 
     bool commit_transaction ()
@@ -175,7 +414,7 @@ public:
         }
 
         _state = _state_stack.top().first;
-        _p = _state_stack.top().second;
+        _p = _origin + (_state_stack.top().second - _origin_pos);
         _state_stack.pop();
 
         return false;
@@ -185,12 +424,31 @@ public:
     {
         if (!_state_stack.empty()) {
             _state = _state_stack.top().first;
-            _p = _state_stack.top().second;
+            _p = _origin + (_state_stack.top().second - _origin_pos);
             _state_stack.pop();
         }
     }
 
 private:
+    std::size_t position () const noexcept
+    {
+        return _origin_pos + static_cast<std::size_t>(_p - _origin);
+    }
+
+    /**
+     * Reads data from the streamed source so that at least @a n bytes become available.
+     * Data starting from the oldest transaction checkpoint is preserved.
+     */
+    bool refill (std::size_t n)
+    {
+        auto keep = _p;
+
+        if (!_state_stack.empty())
+            keep = _origin + (_state_stack.bottom().second - _origin_pos);
+
+        return _buffer.refill(n, keep, _origin, _origin_pos, _p, _end);
+    }
+
     /**
      * Reads byte sequence into string view. Lifetime of the string view must be less or equals to
      * the stream's lifetime
@@ -205,7 +463,7 @@ private:
 
         auto sz = available();
 
-        if (sz < n) {
+        if (sz < n && !refill(n)) {
             _state = status_enum::out_of_bound;
             return view_type(nullptr, 0);
         }
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+//                 `istream_source` does not propagate stream exceptions.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "namespace.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <istream>
+#include <system_error>
+
+#if _MSC_VER
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
+PFS__NAMESPACE_BEGIN
+
+/**
+ * Source for the streamed binary_istream that reads data from the standard input stream.
+ * The stream must outlive the source.
+ *
+ * @code
+ * std::ifstream ifs {"records.bin", std::ios::binary};
+ * pfs::binary_istream<pfs::endian::network, pfs::istream_source> in {pfs::istream_source{ifs}};
+ * @endcode
+ */
+class istream_source
+{
+    std::istream * _is {nullptr};
+
+public:
+    explicit istream_source (std::istream & is) noexcept
+        : _is(& is)
+    {}
+
+    /**
+     * Reads up to @a n bytes into @a buf. Exceptions enabled for the stream are not
+     * propagated.
+     *
+     * @return Number of bytes read, zero at the end of data or on failure (@a ec is set
+     *         to @c std::errc::io_error in last case).
+     */
+    std::size_t read (char * buf, std::size_t n, std::error_code & ec) noexcept
+    {
+        if (!_is->good())
+            return 0;
+
+        try {
+            _is->read(buf, static_cast<std::streamsize>(n));
+        } catch (...) {
+            // Short read sets failbit, it is the end of data if the stream is not bad.
+            // Exceptions of the stream buffer set badbit.
+        }
+
+        if (_is->bad()) {
+            ec = std::make_error_code(std::errc::io_error);
+            return 0;
+        }
+
+        return static_cast<std::size_t>(_is->gcount());
+    }
+};
+
+/**
+ * Source for the streamed binary_istream that reads data from the file descriptor.
+ * The source does not own the descriptor.
+ */
+class fd_source
+{
+    int _fd {-1};
+
+public:
+    explicit fd_source (int fd) noexcept
+        : _fd(fd)
+    {}
+
+    /**
+     * Reads up to @a n bytes into @a buf. Interrupted reads are restarted.
+     *
+     * @return Number of bytes read, zero at the end of data or on failure (@a ec is set
+     *         to the system error in last case).
+     */
+    std::size_t read (char * buf, std::size_t n, std::error_code & ec) noexcept
+    {
+#if _MSC_VER
+        auto rc = ::_read(_fd, buf, static_cast<unsigned int>((std::min)(n, std::size_t{INT_MAX})));
+#else
+        auto rc = ::read(_fd, buf, n);
+
+        while (rc < 0 && errno == EINTR)
+            rc = ::read(_fd, buf, n);
+#endif
+
+        if (rc < 0) {
+            ec = std::error_code{errno, std::generic_category()};
+            return 0;
+        }
+
+        return static_cast<std::size_t>(rc);
+    }
+};
+
+PFS__NAMESPACE_END
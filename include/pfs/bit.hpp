@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "namespace.hpp"
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+PFS__NAMESPACE_BEGIN
+
+/**
+ * Number of consecutive zero bits starting from the least significant one (like C++20
+ * std::countr_zero).
+ */
+inline int countr_zero (std::uint32_t x) noexcept
+{
+    if (x == 0)
+        return 32;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(x);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(& index, x);
+    return static_cast<int>(index);
+#else
+    int n = 0;
+
+    for (; (x & 1) == 0; x >>= 1)
+        n++;
+
+    return n;
+#endif
+}
+
+inline int countr_zero (std::uint64_t x) noexcept
+{
+    if (x == 0)
+        return 64;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(& index, x);
+    return static_cast<int>(index);
+#else
+    auto lo = static_cast<std::uint32_t>(x);
+    return lo != 0 ? countr_zero(lo) : 32 + countr_zero(static_cast<std::uint32_t>(x >> 32));
+#endif
+}
+
+PFS__NAMESPACE_END
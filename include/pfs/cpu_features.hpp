@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "bits/compiler.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#   define PFS__ARCH_X86 1
+#   if defined(__x86_64__) || defined(_M_X64)
+#       define PFS__ARCH_X86_64 1
+#   endif
+#endif
+
+// Define PFS__DISABLE_X86_INTRINSICS to build portable implementations only
+#if PFS__ARCH_X86 && !defined(PFS__DISABLE_X86_INTRINSICS)
+#   if defined(PFS__COMPILER_MSVC) || defined(PFS__COMPILER_GCC) || defined(PFS__COMPILER_CLANG)
+#       define PFS__X86_INTRINSICS_ENABLED 1
+#   endif
+#endif
+
+#if PFS__X86_INTRINSICS_ENABLED
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#   include <immintrin.h>
+#endif
+
+/**
+ * Enables instruction set extensions for the function (intrinsics are used without
+ * global compiler options like -msse4.2, dispatching is performed at runtime).
+ * MSVC does not require it.
+ */
+#if PFS__X86_INTRINSICS_ENABLED && (defined(__GNUC__) || defined(__clang__))
+#   define PFS__TARGET(x) __attribute__((target(x)))
+#else
+#   define PFS__TARGET(x)
+#endif
+
+namespace pfs {
+
+/**
+ * CPU features detected at runtime.
+ */
+struct cpu_feature_set
+{
+    bool sse2 {false};
+    bool ssse3 {false};
+    bool sse41 {false};
+    bool sse42 {false};
+    bool pclmul {false};
+    bool avx {false};
+    bool avx2 {false};
+    bool sha {false};
+};
+
+namespace details {
+
+#if PFS__X86_INTRINSICS_ENABLED
+inline void cpuid (unsigned leaf, unsigned subleaf, unsigned regs[4]) noexcept
+{
+#   if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+    for (int i = 0; i < 4; i++)
+        regs[i] = static_cast<unsigned>(r[i]);
+#   else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#   endif
+}
+
+inline unsigned long long xgetbv0 () noexcept
+{
+#   if defined(_MSC_VER)
+    return _xgetbv(0);
+#   else
+    unsigned eax = 0, edx = 0;
+    __asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#   endif
+}
+#endif
+
+inline cpu_feature_set detect_cpu_features () noexcept
+{
+    cpu_feature_set result;
+
+#if PFS__X86_INTRINSICS_ENABLED
+    unsigned regs[4] = {0, 0, 0, 0};
+
+    cpuid(0, 0, regs);
+    auto max_leaf = regs[0];
+
+    if (max_leaf < 1)
+        return result;
+
+    cpuid(1, 0, regs);
+    auto ecx = regs[2];
+    auto edx = regs[3];
+
+    result.sse2   = (edx & (1u << 26)) != 0;
+    result.ssse3  = (ecx & (1u << 9)) != 0;
+    result.sse41  = (ecx & (1u << 19)) != 0;
+    result.sse42  = (ecx & (1u << 20)) != 0;
+    result.pclmul = (ecx & (1u << 1)) != 0;
+
+    // AVX requires OS support for saving YMM registers
+    bool osxsave = (ecx & (1u << 27)) != 0;
+    bool ymm_enabled = osxsave && (xgetbv0() & 0x6) == 0x6;
+
+    result.avx = (ecx & (1u << 28)) != 0 && ymm_enabled;
+
+    if (max_leaf >= 7) {
+        cpuid(7, 0, regs);
+        auto ebx = regs[1];
+
+        result.avx2 = result.avx && (ebx & (1u << 5)) != 0;
+        result.sha  = (ebx & (1u << 29)) != 0;
+    }
+#endif
+
+    return result;
+}
+
+} // namespace details
+
+/**
+ * Returns CPU features detected at first call.
+ */
+inline cpu_feature_set const & cpu_features () noexcept
+{
+    static cpu_feature_set const features = details::detect_cpu_features();
+    return features;
+}
+
+} // namespace pfs
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Useful links:
+// [A Painless Guide to CRC Error Detection Algorithms](http://www.ross.net/crc/download/crc_v3.txt)
+// [Catalogue of parametrised CRC algorithms](https://reveng.sourceforge.io/crc-catalogue/)
+
+namespace pfs {
+
+namespace details {
+
+template <unsigned Width>
+struct crc_uint
+{
+    using type = typename std::conditional<(Width <= 8), std::uint8_t
+        , typename std::conditional<(Width <= 16), std::uint16_t
+        , typename std::conditional<(Width <= 32), std::uint32_t, std::uint64_t>::type>::type>::type;
+};
+
+constexpr std::uint64_t crc_mask (unsigned width)
+{
+    return width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+}
+
+/**
+ * Reverses the order of lower @a width bits of @a value.
+ */
+constexpr std::uint64_t crc_reflect (std::uint64_t value, unsigned width)
+{
+    std::uint64_t result = 0;
+
+    for (unsigned i = 0; i < width; i++) {
+        if (value & (std::uint64_t{1} << i))
+            result |= std::uint64_t{1} << (width - 1 - i);
+    }
+
+    return result;
+}
+
+template <typename UInt>
+struct crc_table
+{
+    UInt data[256] {};
+
+    constexpr UInt operator [] (std::size_t i) const
+    {
+        return data[i];
+    }
+};
+
+template <typename UInt>
+constexpr crc_table<UInt> crc_make_table (std::uint64_t poly, unsigned width, bool reflect)
+{
+    crc_table<UInt> t;
+
+    if (reflect) {
+        auto rpoly = crc_reflect(poly, width);
+
+        for (unsigned i = 0; i < 256; i++) {
+            std::uint64_t r = i;
+
+            for (int j = 0; j < 8; j++)
+                r = (r & 1) ? (r >> 1) ^ rpoly : r >> 1;
+
+            t.data[i] = static_cast<UInt>(r);
+        }
+    } else {
+        auto top = std::uint64_t{1} << (width - 1);
+        auto mask = crc_mask(width);
+
+        for (unsigned i = 0; i < 256; i++) {
+            std::uint64_t r = static_cast<std::uint64_t>(i) << (width - 8);
+
+            for (int j = 0; j < 8; j++)
+                r = (r & top) ? ((r << 1) ^ poly) & mask : (r << 1) & mask;
+
+            t.data[i] = static_cast<UInt>(r);
+        }
+    }
+
+    return t;
+}
+
+} // namespace details
+
+/**
+ * Table-driven CRC algorithm of @a Width bits for the polynomial @a Poly (normal
+ * representation without the x^Width term). Lookup table is generated at compile time,
+ * so checksums of the constant data (e.g. string literals) can be calculated at compile time.
+ *
+ * @tparam Reflect @c true if input bytes and register are reflected (LSB first).
+ *
+ * @code
+ * using crc32_ieee = pfs::crc<32, 0x04C11DB7, true>;
+ * constexpr auto key = crc32_ieee::of_literal("message_type") ^ 0xFFFFFFFF;
+ * @endcode
+ */
+template <unsigned Width, std::uint64_t Poly, bool Reflect>
+struct crc
+{
+    static_assert(Width >= 8 && Width <= 64, "Unsupported CRC width");
+
+    using value_type = typename details::crc_uint<Width>::type;
+    using table_type = details::crc_table<value_type>;
+
+    static constexpr unsigned width = Width;
+    static constexpr std::uint64_t poly = Poly;
+    static constexpr bool reflect = Reflect;
+
+    static constexpr table_type table = details::crc_make_table<value_type>(Poly, Width, Reflect);
+
+    /**
+     * Updates raw CRC register @a r with the byte @a b.
+     */
+    static constexpr value_type update (value_type r, std::uint8_t b) noexcept
+    {
+        return Reflect
+            ? static_cast<value_type>(table[(r ^ b) & 0xFF] ^ (Width > 8 ? r >> 8 : 0))
+            : static_cast<value_type>((table[((r >> (Width - 8)) ^ b) & 0xFF]
+                ^ (Width > 8 ? static_cast<std::uint64_t>(r) << 8 : 0)) & details::crc_mask(Width));
+    }
+
+    /**
+     * Updates raw CRC register @a r with @a nbytes bytes.
+     */
+    static constexpr value_type update (value_type r, std::uint8_t const * pbytes, std::size_t nbytes) noexcept
+    {
+        for (std::size_t i = 0; i < nbytes; i++)
+            r = update(r, pbytes[i]);
+
+        return r;
+    }
+
+    /**
+     * Updates raw CRC register @a r with @a nchars characters, usable in constant expressions.
+     */
+    static constexpr value_type update (value_type r, char const * s, std::size_t nchars) noexcept
+    {
+        for (std::size_t i = 0; i < nchars; i++)
+            r = update(r, static_cast<std::uint8_t>(s[i]));
+
+        return r;
+    }
+
+    /**
+     * Updates raw CRC register @a r with the characters of the string literal (without
+     * the terminating null character).
+     */
+    template <std::size_t N>
+    static constexpr value_type of_literal (char const (& s)[N], value_type r = 0) noexcept
+    {
+        return update(r, s, N - 1);
+    }
+};
+
+template <unsigned Width, std::uint64_t Poly, bool Reflect>
+constexpr typename crc<Width, Poly, Reflect>::table_type crc<Width, Poly, Reflect>::table;
+
+// CRC-16/XMODEM (crc16_of_ptr)
+using crc16_ccitt_engine = crc<16, 0x1021, false>;
+
+// CRC-32/ISO-HDLC (crc32_of_ptr)
+using crc32_engine = crc<32, 0x04C11DB7, true>;
+
+// CRC-32/ISCSI (crc32c_of_ptr)
+using crc32c_engine = crc<32, 0x1EDC6F41, true>;
+
+// CRC-64 with ISO polynomial (crc64_of_ptr)
+using crc64_engine = crc<64, 0x1B, true>;
+
+} // namespace pfs
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+//      2026.10.19 Added crc32c_of_literal.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cpu_features.hpp"
+#include "crc32.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace pfs {
+
+namespace details {
+
+inline crc32_slicing_tables const & crc32c_slicing8_tables ()
+{
+    // Reversed representation of the Castagnoli polynomial 0x1EDC6F41
+    static constexpr crc32_slicing_tables tables {0x82F63B78};
+    return tables;
+}
+
+/**
+ * Updates raw (not inverted) CRC32C value @a r using lookup tables.
+ */
+inline std::uint32_t crc32c_update_table (std::uint32_t r, std::uint8_t const * pbytes, std::size_t nbytes)
+{
+    return crc32_update_slicing8(crc32c_slicing8_tables(), r, pbytes, nbytes);
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+/**
+ * Updates raw (not inverted) CRC32C value @a r using SSE4.2 CRC32 instruction.
+ * Must be called only if CPU supports it.
+ */
+PFS__TARGET("sse4.2")
+inline std::uint32_t crc32c_update_sse42 (std::uint32_t r, std::uint8_t const * pbytes, std::size_t nbytes)
+{
+#   if PFS__ARCH_X86_64
+    std::uint64_t r64 = r;
+
+    while (nbytes >= 8) {
+        std::uint64_t v;
+        std::memcpy(& v, pbytes, sizeof(v));
+        r64 = _mm_crc32_u64(r64, v);
+        pbytes += 8;
+        nbytes -= 8;
+    }
+
+    r = static_cast<std::uint32_t>(r64);
+#   endif
+
+    while (nbytes >= 4) {
+        std::uint32_t v;
+        std::memcpy(& v, pbytes, sizeof(v));
+        r = _mm_crc32_u32(r, v);
+        pbytes += 4;
+        nbytes -= 4;
+    }
+
+    while (nbytes--)
+        r = _mm_crc32_u8(r, *pbytes++);
+
+    return r;
+}
+#endif
+
+} // namespace details
+
+/**
+ * @brief Calculates the CRC32C (Castagnoli) checksum for the given array of bytes
+ *        using polynomial 0x1EDC6F41.
+ *
+ * @param pdata data for checksum calculation
+ * @param nbytes data length in bytes
+ * @param initial initial value for checksum
+ * @return CRC32C checksum value
+ *
+ * @note Compatible with iSCSI, ext4, java.util.zip.CRC32C.
+ */
+inline std::int32_t crc32c_of_ptr (void const * pdata, std::size_t nbytes, std::int32_t initial = 0)
+{
+    auto pbytes = static_cast<std::uint8_t const *>(pdata);
+    std::uint32_t r = initial ^ 0xFFFFFFFF;
+
+    if (pdata) {
+#if PFS__X86_INTRINSICS_ENABLED
+        if (cpu_features().sse42)
+            r = details::crc32c_update_sse42(r, pbytes, nbytes);
+        else
+#endif
+            r = details::crc32c_update_table(r, pbytes, nbytes);
+
+        r = r ^ 0xFFFFFFFF;
+    }
+
+    return static_cast<std::int32_t>(r);
+}
+
+/**
+ * @brief Calculates the CRC32C checksum for the string literal (without terminating
+ *        null character) at compile time. Result is the same as returned by @c crc32c_of_ptr.
+ */
+template <std::size_t N>
+constexpr std::int32_t crc32c_of_literal (char const (& s)[N], std::int32_t initial = 0)
+{
+    return static_cast<std::int32_t>(crc32c_engine::of_literal(s
+        , static_cast<std::uint32_t>(initial) ^ 0xFFFFFFFF) ^ 0xFFFFFFFF);
+}
+
+inline std::int32_t crc32c_of (std::string const & data, std::int32_t initial = 0)
+{
+    return crc32c_of_ptr(data.data(), data.size(), initial);
+}
+
+} // pfs
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstdint>
+
+// Useful links:
+// [zlib crc32_combine](https://github.com/madler/zlib/blob/master/crc32.c)
+
+namespace pfs {
+namespace details {
+
+/**
+ * Polynomial arithmetic modulo reflected CRC polynomial @a Poly (reversed representation)
+ * of @a UInt width. Used to shift CRC register over a run of zero bytes without processing
+ * them, so CRCs of adjacent blocks can be combined in O(log(n)) time.
+ */
+template <typename UInt, UInt Poly>
+struct crc_gf2
+{
+    static constexpr unsigned width = sizeof(UInt) * 8;
+    static constexpr UInt one = UInt{1} << (width - 1); // x^0 in reflected representation
+
+    /**
+     * Returns a * b mod Poly.
+     */
+    static UInt multmodp (UInt a, UInt b) noexcept
+    {
+        UInt m = one;
+        UInt p = 0;
+
+        for (;;) {
+            if (a & m) {
+                p ^= b;
+
+                if ((a & (m - 1)) == 0)
+                    break;
+            }
+
+            m >>= 1;
+            b = (b & 1) ? (b >> 1) ^ Poly : b >> 1;
+        }
+
+        return p;
+    }
+
+    /**
+     * Returns x^(2^k) mod Poly for k in range [0, width + 3).
+     */
+    static UInt x2k (unsigned k) noexcept
+    {
+        struct table
+        {
+            UInt data[width + 3];
+
+            table ()
+            {
+                UInt p = one >> 1; // x^1
+                data[0] = p;
+
+                for (unsigned i = 1; i < width + 3; i++)
+                    data[i] = p = multmodp(p, p);
+            }
+        };
+
+        static table const t;
+        return t.data[k];
+    }
+
+    /**
+     * Returns x^(8 * nbytes) mod Poly, i.e. operator of shifting CRC over @a nbytes zero bytes.
+     */
+    static UInt xpow8n (std::uint64_t nbytes) noexcept
+    {
+        UInt p = one;
+        unsigned k = 3;
+
+        while (nbytes) {
+            if (nbytes & 1)
+                p = multmodp(x2k(k), p);
+
+            nbytes >>= 1;
+            k++;
+        }
+
+        return p;
+    }
+
+    /**
+     * Combines CRC @a crc1 of the first block with CRC @a crc2 of the second block
+     * of @a len2 bytes.
+     */
+    static UInt combine (UInt crc1, UInt crc2, std::uint64_t len2) noexcept
+    {
+        return multmodp(xpow8n(len2), crc1) ^ crc2;
+    }
+};
+
+}} // namespace pfs::details
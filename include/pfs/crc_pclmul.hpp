@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cpu_features.hpp"
+#include <cstdint>
+#include <cstring>
+
+// Inputs of this size and above are processed using PCLMULQDQ instruction if CPU supports it
+#ifndef PFS__CRC_PCLMUL_THRESHOLD
+#   define PFS__CRC_PCLMUL_THRESHOLD 128
+#endif
+
+// Useful links:
+// [Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction](https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/fast-crc-computation-generic-polynomials-pclmulqdq-paper.pdf)
+
+namespace pfs {
+namespace details {
+
+/**
+ * Calculates x^e mod P for the CRC polynomial P of @a Width bits (@a poly is the normal
+ * representation without the x^Width term). Result is bit-reflected into 64 bits
+ * (x^0 corresponds to bit 63) as required by the folding in reflected domain.
+ */
+constexpr std::uint64_t crc_xpow_mod_reflected (unsigned e, std::uint64_t poly, unsigned width)
+{
+    std::uint64_t top = std::uint64_t{1} << (width - 1);
+    std::uint64_t mask = width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+    std::uint64_t r = 1;
+
+    for (unsigned i = 0; i < e; i++) {
+        bool carry = (r & top) != 0;
+        r = (r << 1) & mask;
+
+        if (carry)
+            r ^= poly;
+    }
+
+    std::uint64_t result = 0;
+
+    for (unsigned i = 0; i < 64; i++) {
+        if (r & (std::uint64_t{1} << i))
+            result |= std::uint64_t{1} << (63 - i);
+    }
+
+    return result;
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+PFS__TARGET("sse2,pclmul")
+inline __m128i crc_fold_128 (__m128i x, __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/**
+ * Folds data of reflected CRC (CRC32, CRC64 etc) using carry-less multiplication. The 16 bytes
+ * stored into @a out have the same CRC (calculated with zero initial register) as the folded
+ * data calculated with the initial (raw) register @a r.
+ *
+ * 128-bit block F = H * x^64 + L (H is the first eight bytes) followed by D bits of data
+ * contributes F * x^D = H * x^(D + 64) + L * x^D to the message. In reflected domain carry-less
+ * product of two 64-bit values gets extra x^1 factor, so fold constants are
+ * x^(D + 63) mod P and x^(D - 1) mod P.
+ *
+ * @param nbytes Number of bytes, must be at least 64.
+ * @return Number of bytes folded (multiple of 16), the rest must be processed by caller.
+ */
+template <unsigned Width, std::uint64_t Poly>
+PFS__TARGET("sse2,pclmul")
+std::size_t crc_fold_pclmul (std::uint64_t r, std::uint8_t const * pbytes, std::size_t nbytes
+    , std::uint8_t out[16])
+{
+    static_assert(Width >= 16 && Width <= 64, "Unsupported CRC width");
+
+    constexpr std::uint64_t k512_h = crc_xpow_mod_reflected(512 + 63, Poly, Width);
+    constexpr std::uint64_t k512_l = crc_xpow_mod_reflected(512 - 1, Poly, Width);
+    constexpr std::uint64_t k384_h = crc_xpow_mod_reflected(384 + 63, Poly, Width);
+    constexpr std::uint64_t k384_l = crc_xpow_mod_reflected(384 - 1, Poly, Width);
+    constexpr std::uint64_t k256_h = crc_xpow_mod_reflected(256 + 63, Poly, Width);
+    constexpr std::uint64_t k256_l = crc_xpow_mod_reflected(256 - 1, Poly, Width);
+    constexpr std::uint64_t k128_h = crc_xpow_mod_reflected(128 + 63, Poly, Width);
+    constexpr std::uint64_t k128_l = crc_xpow_mod_reflected(128 - 1, Poly, Width);
+
+    auto const k512 = _mm_set_epi64x(static_cast<long long>(k512_l), static_cast<long long>(k512_h));
+    auto const k384 = _mm_set_epi64x(static_cast<long long>(k384_l), static_cast<long long>(k384_h));
+    auto const k256 = _mm_set_epi64x(static_cast<long long>(k256_l), static_cast<long long>(k256_h));
+    auto const k128 = _mm_set_epi64x(static_cast<long long>(k128_l), static_cast<long long>(k128_h));
+
+    auto p = pbytes;
+    auto n = nbytes;
+
+    auto x0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+    auto x1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16));
+    auto x2 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 32));
+    auto x3 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 48));
+
+    // Initial register is combined with the first bytes of data
+    x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, static_cast<long long>(r)));
+
+    p += 64;
+    n -= 64;
+
+    while (n >= 64) {
+        x0 = _mm_xor_si128(crc_fold_128(x0, k512), _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)));
+        x1 = _mm_xor_si128(crc_fold_128(x1, k512), _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16)));
+        x2 = _mm_xor_si128(crc_fold_128(x2, k512), _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 32)));
+        x3 = _mm_xor_si128(crc_fold_128(x3, k512), _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 48)));
+        p += 64;
+        n -= 64;
+    }
+
+    auto x = _mm_xor_si128(_mm_xor_si128(crc_fold_128(x0, k384), crc_fold_128(x1, k256))
+        , _mm_xor_si128(crc_fold_128(x2, k128), x3));
+
+    while (n >= 16) {
+        x = _mm_xor_si128(crc_fold_128(x, k128), _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)));
+        p += 16;
+        n -= 16;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), x);
+
+    return nbytes - n;
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+}} // namespace pfs::details
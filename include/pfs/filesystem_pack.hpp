@@ -7,6 +7,7 @@
 //      2024.07.04 Initial version.
 //      2025.08.11 pack/upack() functions are deprecated.
 //      2025.08.12 Removed deprecated functions.
+//      2026.10.19 Support for streamed binary_istream.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "c++support.hpp"
@@ -24,8 +25,8 @@ inline void pack (binary_ostream<Endianess, Archive> & out, filesystem::path con
     out << pfs::numeric_cast<std::uint16_t>(text.size()) << text;
 }
 
-template <endian Endianess>
-void unpack (binary_istream<Endianess> & in, filesystem::path & p)
+template <endian Endianess, typename Source>
+void unpack (binary_istream<Endianess, Source> & in, filesystem::path & p)
 {
     std::string text;
     std::uint16_t sz = 0;
@@ -6,23 +6,200 @@
 // Changelog:
 //      2017.01.26 Initial version of pfs/algo/find.hpp
 //      2021.07.06 Refactored.
+//      2026.10.19 Added fast path for contiguous `char` sequences.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include "bit.hpp"
+#include "cpu_features.hpp"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+// Useful links:
+// [SIMD-friendly algorithms for substring searching](http://0x80.pl/articles/simd-strfind.html)
+// [Boyer-Moore-Horspool algorithm](https://en.wikipedia.org/wiki/Boyer%E2%80%93Moore%E2%80%93Horspool_algorithm)
+
+// Minimum needle length to search with Boyer-Moore-Horspool algorithm (if SIMD is not available)
+#ifndef PFS__FIND_HORSPOOL_THRESHOLD
+#   define PFS__FIND_HORSPOOL_THRESHOLD 64
+#endif
 
 namespace pfs {
 
+namespace details {
+
+template <typename It>
+struct is_contiguous_char_iterator : std::integral_constant<bool
+    , std::is_same<It, char *>::value
+    || std::is_same<It, char const *>::value
+    || std::is_same<It, std::string::iterator>::value
+    || std::is_same<It, std::string::const_iterator>::value
+    || std::is_same<It, std::vector<char>::iterator>::value
+    || std::is_same<It, std::vector<char>::const_iterator>::value>
+{};
+
 /**
- * Find occurrence of sequence (needle) specified
- * by pair @a needle_begin and @a needle_end in sequence (haystack) specified
- * by pair @a haystack_begin and @a haystack_end and return pair of iterators
- * indicating first and last position of needle in haystack.
+ * Searches with memchr() by the first byte, candidates are checked by the last byte
+ * before comparing the rest.
  */
+inline char const * find_chars_memchr (char const * h, std::size_t hn, char const * n, std::size_t nn) noexcept
+{
+    if (nn > hn)
+        return nullptr;
+
+    auto p = h;
+    auto last = h + (hn - nn);
+
+    while (p <= last) {
+        p = static_cast<char const *>(std::memchr(p, n[0], static_cast<std::size_t>(last - p) + 1));
+
+        if (p == nullptr)
+            return nullptr;
+
+        if (p[nn - 1] == n[nn - 1] && std::memcmp(p + 1, n + 1, nn - 1) == 0)
+            return p;
+
+        ++p;
+    }
+
+    return nullptr;
+}
+
+inline char const * find_chars_horspool (char const * h, std::size_t hn, char const * n, std::size_t nn) noexcept
+{
+    if (nn > hn)
+        return nullptr;
+
+    std::size_t skip[256];
+
+    for (auto & x: skip)
+        x = nn;
+
+    for (std::size_t i = 0; i + 1 < nn; i++)
+        skip[static_cast<unsigned char>(n[i])] = nn - 1 - i;
+
+    auto last_char = n[nn - 1];
+
+    for (std::size_t i = 0; i <= hn - nn; ) {
+        auto c = h[i + nn - 1];
+
+        if (c == last_char && std::memcmp(h + i, n, nn - 1) == 0)
+            return h + i;
+
+        i += skip[static_cast<unsigned char>(c)];
+    }
+
+    return nullptr;
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+// Generic SIMD algorithm: positions where both the first and the last bytes of the needle
+// match are compared entirely. Needle must be at least two bytes.
+#define PFS__FIND_CHARS_KERNEL(NAME, TARGET, WIDTH, MASK_TYPE, LOAD, SET1, CMPEQ, AND, MOVEMASK) \
+PFS__TARGET(TARGET)                                                                        \
+inline char const * NAME (char const * h, std::size_t hn, char const * n, std::size_t nn) noexcept \
+{                                                                                          \
+    auto first = SET1(n[0]);                                                               \
+    auto last = SET1(n[nn - 1]);                                                           \
+    std::size_t i = 0;                                                                     \
+                                                                                           \
+    for (; i + nn - 1 + WIDTH <= hn; i += WIDTH) {                                         \
+        auto b0 = LOAD(h + i);                                                             \
+        auto b1 = LOAD(h + i + nn - 1);                                                    \
+        auto mask = static_cast<MASK_TYPE>(MOVEMASK(AND(CMPEQ(first, b0), CMPEQ(last, b1)))); \
+                                                                                           \
+        while (mask != 0) {                                                                \
+            auto pos = i + static_cast<std::size_t>(countr_zero(mask));                    \
+                                                                                           \
+            if (std::memcmp(h + pos + 1, n + 1, nn - 2) == 0)                              \
+                return h + pos;                                                            \
+                                                                                           \
+            mask &= mask - 1;                                                              \
+        }                                                                                  \
+    }                                                                                      \
+                                                                                           \
+    return find_chars_memchr(h + i, hn - i, n, nn);                                        \
+}
+
+#define PFS__FIND_LOAD128(p) _mm_loadu_si128(reinterpret_cast<__m128i const *>(p))
+#define PFS__FIND_LOAD256(p) _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p))
+
+PFS__FIND_CHARS_KERNEL(find_chars_sse2, "sse2", 16, std::uint32_t, PFS__FIND_LOAD128
+    , _mm_set1_epi8, _mm_cmpeq_epi8, _mm_and_si128, _mm_movemask_epi8)
+
+PFS__FIND_CHARS_KERNEL(find_chars_avx2, "avx2", 32, std::uint32_t, PFS__FIND_LOAD256
+    , _mm256_set1_epi8, _mm256_cmpeq_epi8, _mm256_and_si256, _mm256_movemask_epi8)
+
+#undef PFS__FIND_LOAD128
+#undef PFS__FIND_LOAD256
+#undef PFS__FIND_CHARS_KERNEL
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+/**
+ * Finds the first occurrence of the needle @a n of length @a nn in the haystack @a h
+ * of length @a hn.
+ *
+ * @return Pointer to the occurrence or @c nullptr if not found (or needle is empty).
+ */
+inline char const * find_chars (char const * h, std::size_t hn, char const * n, std::size_t nn) noexcept
+{
+    if (nn == 0 || nn > hn)
+        return nullptr;
+
+    if (nn == 1)
+        return static_cast<char const *>(std::memchr(h, n[0], hn));
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().avx2)
+        return find_chars_avx2(h, hn, n, nn);
+
+    if (cpu_features().sse2)
+        return find_chars_sse2(h, hn, n, nn);
+#endif
+
+    // SIMD filter outperforms Horspool algorithm even for long needles (skip distance
+    // of Horspool is limited by the alphabet size of the text), so Horspool algorithm
+    // is used by portable implementation only.
+    if (nn >= PFS__FIND_HORSPOOL_THRESHOLD)
+        return find_chars_horspool(h, hn, n, nn);
+
+    return find_chars_memchr(h, hn, n, nn);
+}
+
 template <typename ForwardIt1, typename ForwardIt2>
 std::pair<ForwardIt1, ForwardIt1> find (ForwardIt1 haystack_begin
     , ForwardIt1 haystack_end
     , ForwardIt2 needle_begin
-    , ForwardIt2 needle_end)
+    , ForwardIt2 needle_end
+    , std::true_type /*contiguous*/)
+{
+    if (haystack_begin == haystack_end || needle_begin == needle_end)
+        return std::make_pair(haystack_end, haystack_end);
+
+    auto hn = static_cast<std::size_t>(haystack_end - haystack_begin);
+    auto nn = static_cast<std::size_t>(needle_end - needle_begin);
+    auto h = static_cast<char const *>(std::addressof(*haystack_begin));
+    auto p = find_chars(h, hn, std::addressof(*needle_begin), nn);
+
+    if (p == nullptr)
+        return std::make_pair(haystack_end, haystack_end);
+
+    auto first = haystack_begin + (p - h);
+    return std::make_pair(first, first + static_cast<std::ptrdiff_t>(nn));
+}
+
+template <typename ForwardIt1, typename ForwardIt2>
+std::pair<ForwardIt1, ForwardIt1> find (ForwardIt1 haystack_begin
+    , ForwardIt1 haystack_end
+    , ForwardIt2 needle_begin
+    , ForwardIt2 needle_end
+    , std::false_type /*contiguous*/)
 {
     if (haystack_begin == haystack_end)
         return std::make_pair(haystack_end, haystack_end);
@@ -55,6 +232,31 @@ std::pair<ForwardIt1, ForwardIt1> find (ForwardIt1 haystack_begin
     return std::make_pair(haystack_end, haystack_end);
 }
 
+} // namespace details
+
+/**
+ * Find occurrence of sequence (needle) specified
+ * by pair @a needle_begin and @a needle_end in sequence (haystack) specified
+ * by pair @a haystack_begin and @a haystack_end and return pair of iterators
+ * indicating first and last position of needle in haystack.
+ *
+ * Contiguous sequences of `char` (pointers, `std::string` and `std::vector<char>` iterators)
+ * are searched with memchr() and SIMD (Boyer-Moore-Horspool algorithm for long needles
+ * if SIMD is not available).
+ */
+template <typename ForwardIt1, typename ForwardIt2>
+std::pair<ForwardIt1, ForwardIt1> find (ForwardIt1 haystack_begin
+    , ForwardIt1 haystack_end
+    , ForwardIt2 needle_begin
+    , ForwardIt2 needle_end)
+{
+    using contiguous = std::integral_constant<bool
+        , details::is_contiguous_char_iterator<ForwardIt1>::value
+            && details::is_contiguous_char_iterator<ForwardIt2>::value>;
+
+    return details::find(haystack_begin, haystack_end, needle_begin, needle_end, contiguous{});
+}
+
 // template <typename InputIt1, typename InputIt2>
 // InputIt1 rfind (
 //           InputIt1 haystack_begin
@@ -0,0 +1,338 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cpu_features.hpp"
+#include "error.hpp"
+#include "fmt.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// Hex (base16) encoding and decoding of binary data.
+//
+// Useful links:
+// [Faster Base64 Encoding and Decoding Using AVX2 Instructions](https://arxiv.org/abs/1704.00605)
+// [Parsing hex numbers fast](http://0x80.pl/notesen/2022-01-17-validating-hex-parse.html)
+
+namespace pfs {
+
+namespace details {
+
+struct hex_table
+{
+    char lower[256][2];
+    char upper[256][2];
+    std::uint8_t value[256]; // Value of hex digit or 0xFF for invalid character
+
+    constexpr hex_table () : lower {}, upper {}, value {}
+    {
+        constexpr char lower_digits[] = "0123456789abcdef";
+        constexpr char upper_digits[] = "0123456789ABCDEF";
+
+        for (int i = 0; i < 256; i++) {
+            lower[i][0] = lower_digits[i >> 4];
+            lower[i][1] = lower_digits[i & 0x0F];
+            upper[i][0] = upper_digits[i >> 4];
+            upper[i][1] = upper_digits[i & 0x0F];
+            value[i] = 0xFF;
+        }
+
+        for (int i = 0; i < 16; i++) {
+            value[static_cast<unsigned char>(lower_digits[i])] = static_cast<std::uint8_t>(i);
+            value[static_cast<unsigned char>(upper_digits[i])] = static_cast<std::uint8_t>(i);
+        }
+    }
+};
+
+inline hex_table const & hex_lookup_table ()
+{
+    static constexpr hex_table table;
+    return table;
+}
+
+inline char * hex_encode_scalar (std::uint8_t const * in, std::size_t n, char * out, bool uppercase) noexcept
+{
+    auto digits = uppercase ? hex_lookup_table().upper : hex_lookup_table().lower;
+
+    for (std::size_t i = 0; i < n; i++) {
+        *out++ = digits[in[i]][0];
+        *out++ = digits[in[i]][1];
+    }
+
+    return out;
+}
+
+/**
+ * Decodes @a n bytes from 2 * @a n hex digits.
+ *
+ * @return Position of the first invalid character or 2 * @a n on success.
+ */
+inline std::size_t hex_decode_scalar (char const * in, std::size_t n, std::uint8_t * out) noexcept
+{
+    auto const & value = hex_lookup_table().value;
+
+    for (std::size_t i = 0; i < n; i++) {
+        auto hi = value[static_cast<unsigned char>(in[2 * i])];
+        auto lo = value[static_cast<unsigned char>(in[2 * i + 1])];
+
+        if ((hi | lo) == 0xFF)
+            return hi == 0xFF ? 2 * i : 2 * i + 1;
+
+        out[i] = static_cast<std::uint8_t>((hi << 4) | lo);
+    }
+
+    return 2 * n;
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+/**
+ * Encodes 16 bytes per iteration: nibbles are converted into digits by PSHUFB lookup
+ * and interleaved.
+ */
+PFS__TARGET("ssse3")
+inline char * hex_encode_ssse3 (std::uint8_t const * in, std::size_t n, char * out, bool uppercase) noexcept
+{
+    auto lut = uppercase
+        ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+        : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    auto mask = _mm_set1_epi8(0x0F);
+
+    for (; n >= 16; n -= 16, in += 16, out += 32) {
+        auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in));
+        auto hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+        auto lo = _mm_shuffle_epi8(lut, _mm_and_si128(x, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    return hex_encode_scalar(in, n, out, uppercase);
+}
+
+PFS__TARGET("avx2")
+inline char * hex_encode_avx2 (std::uint8_t const * in, std::size_t n, char * out, bool uppercase) noexcept
+{
+    auto lut = uppercase
+        ? _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+            , '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+        : _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+            , '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    auto mask = _mm256_set1_epi8(0x0F);
+
+    for (; n >= 32; n -= 32, in += 32, out += 64) {
+        auto x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in));
+        auto hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+        auto lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(x, mask));
+
+        // Unpacking works within 128-bit lanes
+        auto a = _mm256_unpacklo_epi8(hi, lo);
+        auto b = _mm256_unpackhi_epi8(hi, lo);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    return hex_encode_ssse3(in, n, out, uppercase);
+}
+
+/**
+ * Converts 16 hex digits into their values.
+ *
+ * @return Mask of valid characters (one bit per character).
+ */
+PFS__TARGET("ssse3")
+inline int hex_digits_ssse3 (__m128i c, __m128i & value) noexcept
+{
+    // Characters above 0x7F are negative and so fail both range checks
+    auto d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    auto l = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    auto a = _mm_sub_epi8(l, _mm_set1_epi8('a' - 10));
+    auto is_alpha = _mm_and_si128(_mm_cmpgt_epi8(l, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(l, _mm_set1_epi8('f' + 1)));
+
+    value = _mm_or_si128(_mm_and_si128(is_digit, d), _mm_and_si128(is_alpha, a));
+    return _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha));
+}
+
+/**
+ * Decodes 16 bytes per iteration: adjacent digit values are combined by PMADDUBSW
+ * (hi * 16 + lo) and packed.
+ */
+PFS__TARGET("ssse3")
+inline std::size_t hex_decode_ssse3 (char const * in, std::size_t n, std::uint8_t * out) noexcept
+{
+    auto weights = _mm_set1_epi16(0x0110);
+    std::size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i v0, v1;
+        auto m0 = hex_digits_ssse3(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 2 * i)), v0);
+        auto m1 = hex_digits_ssse3(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + 2 * i + 16)), v1);
+
+        // Invalid character position is found by scalar decoder
+        if ((m0 & m1) != 0xFFFF)
+            return 2 * i + hex_decode_scalar(in + 2 * i, 16, out + i);
+
+        auto r = _mm_packus_epi16(_mm_maddubs_epi16(v0, weights), _mm_maddubs_epi16(v1, weights));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), r);
+    }
+
+    return 2 * i + hex_decode_scalar(in + 2 * i, n - i, out + i);
+}
+
+PFS__TARGET("avx2")
+inline std::uint32_t hex_digits_avx2 (__m256i c, __m256i & value) noexcept
+{
+    auto d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    auto is_digit = _mm256_andnot_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('9'))
+        , _mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)));
+    auto l = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+    auto a = _mm256_sub_epi8(l, _mm256_set1_epi8('a' - 10));
+    auto is_alpha = _mm256_andnot_si256(_mm256_cmpgt_epi8(l, _mm256_set1_epi8('f'))
+        , _mm256_cmpgt_epi8(l, _mm256_set1_epi8('a' - 1)));
+
+    value = _mm256_or_si256(_mm256_and_si256(is_digit, d), _mm256_and_si256(is_alpha, a));
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)));
+}
+
+PFS__TARGET("avx2")
+inline std::size_t hex_decode_avx2 (char const * in, std::size_t n, std::uint8_t * out) noexcept
+{
+    auto weights = _mm256_set1_epi16(0x0110);
+    std::size_t i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        __m256i v0, v1;
+        auto m0 = hex_digits_avx2(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + 2 * i)), v0);
+        auto m1 = hex_digits_avx2(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + 2 * i + 32)), v1);
+
+        if ((m0 & m1) != 0xFFFFFFFF)
+            return 2 * i + hex_decode_scalar(in + 2 * i, 32, out + i);
+
+        // Packing works within 128-bit lanes, restore the order of 64-bit quarters
+        auto r = _mm256_packus_epi16(_mm256_maddubs_epi16(v0, weights), _mm256_maddubs_epi16(v1, weights));
+        r = _mm256_permute4x64_epi64(r, 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), r);
+    }
+
+    return 2 * i + hex_decode_ssse3(in + 2 * i, n - i, out + i);
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+} // namespace details
+
+/**
+ * Encodes @a n bytes into 2 * @a n hex digits.
+ *
+ * @param out Output buffer of at least 2 * @a n characters (no terminating null character
+ *        is written).
+ * @return Pointer to the character after the last written.
+ */
+inline char * to_hex (void const * data, std::size_t n, char * out, bool uppercase = false) noexcept
+{
+    auto in = static_cast<std::uint8_t const *>(data);
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (n >= 32 && cpu_features().avx2)
+        return details::hex_encode_avx2(in, n, out, uppercase);
+
+    if (n >= 16 && cpu_features().ssse3)
+        return details::hex_encode_ssse3(in, n, out, uppercase);
+#endif
+
+    return details::hex_encode_scalar(in, n, out, uppercase);
+}
+
+inline std::string to_hex (void const * data, std::size_t n, bool uppercase = false)
+{
+    std::string result(2 * n, '\0');
+
+    if (n > 0)
+        to_hex(data, n, & result[0], uppercase);
+
+    return result;
+}
+
+template <std::size_t N>
+inline std::string to_hex (std::array<std::uint8_t, N> const & data, bool uppercase = false)
+{
+    return to_hex(data.data(), N, uppercase);
+}
+
+inline std::string to_hex (std::vector<std::uint8_t> const & data, bool uppercase = false)
+{
+    return to_hex(data.data(), data.size(), uppercase);
+}
+
+/**
+ * Decodes hex digits (in any case) of the string @a s of length @a n into @a n / 2 bytes.
+ *
+ * @param out Output buffer of at least @a n / 2 bytes.
+ * @return Position of the first invalid character or @a n on success. For odd @a n
+ *         the last character is invalid.
+ */
+inline std::size_t from_hex (char const * s, std::size_t n, void * out) noexcept
+{
+    auto pout = static_cast<std::uint8_t *>(out);
+    std::size_t pos = 0;
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (n >= 64 && cpu_features().avx2)
+        pos = details::hex_decode_avx2(s, n / 2, pout);
+    else if (n >= 32 && cpu_features().ssse3)
+        pos = details::hex_decode_ssse3(s, n / 2, pout);
+    else
+#endif
+        pos = details::hex_decode_scalar(s, n / 2, pout);
+
+    return pos;
+}
+
+/**
+ * @return Decoded bytes. On failure @a ec set to @c std::errc::invalid_argument and
+ *         @a error_pos (if not null) to the position of the first invalid character.
+ */
+inline std::vector<std::uint8_t> from_hex (std::string const & s, std::error_code & ec
+    , std::size_t * error_pos = nullptr)
+{
+    std::vector<std::uint8_t> result(s.size() / 2);
+    auto pos = from_hex(s.data(), s.size(), result.data());
+
+    if (pos != s.size()) {
+        ec = make_error_code(std::errc::invalid_argument);
+
+        if (error_pos != nullptr)
+            *error_pos = pos;
+
+        return std::vector<std::uint8_t>{};
+    }
+
+    return result;
+}
+
+/**
+ * @throws error{std::errc::invalid_argument}.
+ */
+inline std::vector<std::uint8_t> from_hex (std::string const & s)
+{
+    std::error_code ec;
+    std::size_t pos = 0;
+    auto result = from_hex(s, ec, & pos);
+
+    if (ec)
+        throw error {ec, fmt::format("invalid hex digit at position {}", pos)};
+
+    return result;
+}
+
+} // namespace pfs
@@ -5,62 +5,181 @@
 //
 // Changelog:
 //      2025.07.07 Initial version.
+//      2026.10.19 Table-driven encoding with exact preallocation of the result.
+//                 Added overloads writing into output iterator and `FILE *`.
+//      2026.10.19 Lookup table shared with `hex.hpp`.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "namespace.hpp"
-#include "fmt.hpp"
+#include "assert.hpp"
+#include "hex.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <iterator>
-#include <cctype>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 PFS__NAMESPACE_BEGIN
 
+namespace details {
+
 /**
- * Hex dump of bytes.
+ * Number of hex digits of the offset field (eight at least).
+ */
+inline int hexdump_offset_width (std::uint64_t offset) noexcept
+{
+    int width = 8;
+
+    for (offset >>= 32; offset != 0; offset >>= 4)
+        width++;
+
+    return width;
+}
+
+/**
+ * Size of the line for @a n bytes (@a n <= @a bytes_per_line) including new line character.
+ */
+inline std::size_t hexdump_line_size (std::uint64_t offset, std::size_t n, std::size_t bytes_per_line) noexcept
+{
+    return static_cast<std::size_t>(hexdump_offset_width(offset)) + 2 + 3 * bytes_per_line + 1 + n + 1;
+}
+
+/**
+ * Exact size of the dump of @a size bytes.
+ */
+inline std::size_t hexdump_size (std::uint64_t size, std::size_t bytes_per_line) noexcept
+{
+    std::size_t result = 0;
+
+    for (std::uint64_t offset = 0; offset < size; offset += bytes_per_line) {
+        auto n = static_cast<std::size_t>((std::min)(static_cast<std::uint64_t>(bytes_per_line), size - offset));
+        result += hexdump_line_size(offset, n, bytes_per_line);
+    }
+
+    return result;
+}
+
+/**
+ * Writes the line for @a n bytes (@a n <= @a bytes_per_line) into @a out. Buffer must be
+ * at least hexdump_line_size() characters.
  *
- * @param first Pointer to first byte.
- * @param last Pointer to byte after last.
- * @param bytes_per_line Number of hex and ASCII encoded bytes per line.
- * @return Hex dump.
+ * @return Pointer to the character after the line.
  */
-template <typename OctetForwardIterator>
-std::string hexdump (OctetForwardIterator first, OctetForwardIterator last, std::size_t bytes_per_line = 16)
+inline char * hexdump_line (char * out, std::uint64_t offset, std::uint8_t const * bytes, std::size_t n
+    , std::size_t bytes_per_line) noexcept
 {
-    // constexpr std::size_t offset_field_size = 10;
+    auto const & hex = ::pfs::details::hex_lookup_table().upper;
 
-    std::size_t offset = 0;
-    // std::size_t reserve_line_size = offset_field_size + 4 * bytes_per_line;
-    // std::size_t reserve_size = reserve_line_size * (1 + size / bytes_per_line) ;
-    std::string result;
+    for (int i = hexdump_offset_width(offset) - 1; i >= 0; i--)
+        *out++ = hex[(offset >> (i * 4)) & 0x0F][1];
 
-    // result.reserve(reserve_size);
-    auto pos = first;
+    *out++ = ' ';
+    *out++ = ' ';
+
+    for (std::size_t i = 0; i < n; i++) {
+        *out++ = hex[bytes[i]][0];
+        *out++ = hex[bytes[i]][1];
+        *out++ = ' ';
+    }
 
-    std::string hex;
-    std::string ascii;
+    out = std::fill_n(out, 3 * (bytes_per_line - n) + 1, ' ');
 
-    while (pos != last) {
-        hex.clear();
-        ascii.clear();
+    for (std::size_t i = 0; i < n; i++)
+        *out++ = (bytes[i] >= 0x20 && bytes[i] < 0x7F) ? static_cast<char>(bytes[i]) : '.';
 
-        std::size_t j = 0;
+    *out++ = '\n';
 
-        for (; j < bytes_per_line && pos != last; j++, ++pos) {
-            auto ch = static_cast<char>(*pos);
+    return out;
+}
 
-            hex += fmt::format("{:02X} ", ch);
-            ascii += std::isprint(ch) ? ch : '.';
-        }
+/**
+ * Splits range into lines and passes each formatted line to @a sink (as pair of pointers).
+ */
+template <typename OctetInputIterator, typename Sink>
+void hexdump_lines (OctetInputIterator first, OctetInputIterator last, std::size_t bytes_per_line, Sink && sink)
+{
+    PFS__ASSERT(bytes_per_line > 0, "hexdump: bytes per line must be greater than zero");
 
-        if (j < bytes_per_line) {
-            j = bytes_per_line - j;
+    std::vector<std::uint8_t> bytes(bytes_per_line);
+    std::vector<char> line(hexdump_line_size(UINT64_MAX, bytes_per_line, bytes_per_line));
+    std::uint64_t offset = 0;
 
-            while (j-- > 0)
-                hex += "   ";
-        }
+    while (first != last) {
+        std::size_t n = 0;
 
-        result += fmt::format("{:08X}  {} {}\n", offset, hex, ascii);
+        for (; n < bytes_per_line && first != last; n++, ++first)
+            bytes[n] = static_cast<std::uint8_t>(*first);
+
+        auto end = hexdump_line(line.data(), offset, bytes.data(), n, bytes_per_line);
+        sink(static_cast<char const *>(line.data()), static_cast<char const *>(end));
         offset += bytes_per_line;
     }
+}
+
+} // namespace details
+
+/**
+ * Hex dump of bytes written into the output iterator line by line, so the whole dump
+ * is never stored in memory.
+ *
+ * @param first Iterator to the first byte.
+ * @param last Iterator to the byte after last.
+ * @param out Output iterator of characters.
+ * @param bytes_per_line Number of hex and ASCII encoded bytes per line.
+ * @return Output iterator after the last written character.
+ */
+template <typename OctetInputIterator, typename CharOutputIterator
+    , typename = typename std::enable_if<!std::is_integral<CharOutputIterator>::value>::type>
+CharOutputIterator hexdump (OctetInputIterator first, OctetInputIterator last, CharOutputIterator out
+    , std::size_t bytes_per_line = 16)
+{
+    details::hexdump_lines(first, last, bytes_per_line, [& out] (char const * b, char const * e) {
+        out = std::copy(b, e, out);
+    });
+
+    return out;
+}
+
+/**
+ * Hex dump of bytes written into the stream @a f.
+ *
+ * @return @c false on write failure.
+ */
+template <typename OctetInputIterator>
+bool hexdump (OctetInputIterator first, OctetInputIterator last, std::FILE * f, std::size_t bytes_per_line = 16)
+{
+    bool success = true;
+
+    details::hexdump_lines(first, last, bytes_per_line, [f, & success] (char const * b, char const * e) {
+        auto n = static_cast<std::size_t>(e - b);
+
+        if (success && std::fwrite(b, 1, n, f) != n)
+            success = false;
+    });
+
+    return success;
+}
+
+/**
+ * Hex dump of bytes.
+ *
+ * @param first Iterator to the first byte.
+ * @param last Iterator to the byte after last.
+ * @param bytes_per_line Number of hex and ASCII encoded bytes per line.
+ * @return Hex dump.
+ */
+template <typename OctetForwardIterator>
+std::string hexdump (OctetForwardIterator first, OctetForwardIterator last, std::size_t bytes_per_line = 16)
+{
+    PFS__ASSERT(bytes_per_line > 0, "hexdump: bytes per line must be greater than zero");
+
+    auto size = static_cast<std::uint64_t>(std::distance(first, last));
+    std::string result(details::hexdump_size(size, bytes_per_line), '\0');
+
+    if (!result.empty())
+        hexdump(first, last, & result[0], bytes_per_line);
 
     return result;
 }
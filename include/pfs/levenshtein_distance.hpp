@@ -5,12 +5,15 @@
 //
 // Changelog:
 //      2023.04.12 Initial version.
+//      2026.10.19 Added blocked bit-parallel algorithm (`hyyro2003`).
 //
 // See:
 //      1. https://en.wikipedia.org/wiki/Levenshtein_distance
 //      2. https://en.wikipedia.org/wiki/Levenshtein_distance#Iterative_with_two_matrix_rows
 //      3. https://github.com/wooorm/levenshtein.c
 //      4. https://github.com/hiddentao/fast-levenshtein
+//      5. H. Hyyro. "A bit-vector algorithm for computing Levenshtein and Damerau
+//         edit distances." Nordic Journal of Computing, 2003.
 //
 // Notes
 //      * Fast implementation inspired by [2], [3] and [4].
@@ -23,8 +26,10 @@
 #include "type_traits.hpp"
 #include <algorithm>
 #include <iterator>
+#include <cstdint>
 #include <cstring>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace pfs {
@@ -38,6 +43,9 @@ enum class levenshtein_distance_algo {
 
     , myers1999
 
+    // Myers' algorithm for sequences of any length (blocks of 64 bits)
+    , hyyro2003
+
     // https://en.wikipedia.org/wiki/Hamming_distance
     , hamming
 };
@@ -378,6 +386,217 @@ levenshtein_distance_myers1999 (ForwardIter xbegin, ForwardIter xend
     return Score;
 }
 
+namespace details {
+
+// Key of the sequence element in the table of match vectors
+template <typename T>
+inline auto peq_key (T const & c, int) noexcept -> decltype(static_cast<std::uint64_t>(c.value))
+{
+    return static_cast<std::uint64_t>(c.value);
+}
+
+template <typename T>
+inline std::uint64_t peq_key (T const & c, long) noexcept
+{
+    return static_cast<std::uint64_t>(c);
+}
+
+/**
+ * Match vectors (bit j of block j / 64 is set if the element matches j-th element of
+ * the pattern) indexed by the element key. Open addressing hash map, so any Unicode
+ * character is applicable.
+ */
+class levenshtein_peq
+{
+    std::size_t _blocks;
+    std::size_t _size {0};
+    std::vector<std::uint64_t> _keys;
+    std::vector<std::uint8_t> _used;
+    std::vector<std::uint64_t> _words;
+
+private:
+    std::size_t slot (std::uint64_t key) const noexcept
+    {
+        auto mask = _keys.size() - 1;
+        auto i = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+
+        while (_used[i] && _keys[i] != key)
+            i = (i + 1) & mask;
+
+        return i;
+    }
+
+    void rehash (std::size_t capacity)
+    {
+        levenshtein_peq other {_blocks, capacity};
+
+        for (std::size_t i = 0; i < _keys.size(); i++) {
+            if (_used[i]) {
+                std::copy_n(& _words[i * _blocks], _blocks, other.insert(_keys[i]));
+            }
+        }
+
+        *this = std::move(other);
+    }
+
+public:
+    levenshtein_peq (std::size_t blocks, std::size_t capacity = 64)
+        : _blocks(blocks)
+        , _keys(capacity)
+        , _used(capacity)
+        , _words(capacity * blocks)
+    {}
+
+    /**
+     * Match vector of the element @a key or @c nullptr if not found.
+     */
+    std::uint64_t const * find (std::uint64_t key) const noexcept
+    {
+        auto i = slot(key);
+        return _used[i] ? & _words[i * _blocks] : nullptr;
+    }
+
+    /**
+     * Match vector of the element @a key, zero initialized if inserted.
+     */
+    std::uint64_t * insert (std::uint64_t key)
+    {
+        auto i = slot(key);
+
+        if (!_used[i]) {
+            if (2 * (_size + 1) > _keys.size()) {
+                rehash(2 * _keys.size());
+                i = slot(key);
+            }
+
+            _used[i] = 1;
+            _keys[i] = key;
+            _size++;
+        }
+
+        return & _words[i * _blocks];
+    }
+};
+
+} // namespace details
+
+//
+// Myers' bit-parallel algorithm for the sequences of any length: the pattern (shorter
+// sequence) is split into the blocks of 64 bits, see [5] and Myers' paper above.
+//
+// Match vectors are stored in the hash map, so any element type (including Unicode
+// characters) is applicable. Equality comparator is used as is: the match vectors are
+// built from the pattern by the element value for the default comparator, and by
+// comparing each distinct element of the text with the pattern otherwise.
+//
+template <typename ForwardIter
+    , typename EqualityComparator = default_equality_comparator<pointer_dereference_t<ForwardIter>>>
+typename std::iterator_traits<ForwardIter>::difference_type
+levenshtein_distance_hyyro2003 (ForwardIter xbegin, ForwardIter xend
+    , ForwardIter ybegin, ForwardIter yend)
+{
+    using difference_type = typename std::iterator_traits<ForwardIter>::difference_type;
+    using value_type = typename std::decay<pointer_dereference_t<ForwardIter>>::type;
+
+    if (xbegin == ybegin && xend == yend)
+        return 0;
+
+    auto xlen = std::distance(xbegin, xend);
+    auto ylen = std::distance(ybegin, yend);
+
+    if (xlen == 0)
+        return ylen;
+
+    if (ylen == 0)
+        return xlen;
+
+    // Shorter sequence is the pattern
+    if (ylen > xlen) {
+        std::swap(xbegin, ybegin);
+        std::swap(xend, yend);
+        std::swap(xlen, ylen);
+    }
+
+    auto m = static_cast<std::size_t>(ylen);
+    auto blocks = (m + 63) / 64;
+
+    constexpr bool default_eq = std::is_same<EqualityComparator
+        , default_equality_comparator<pointer_dereference_t<ForwardIter>>>::value;
+
+    details::levenshtein_peq peq {blocks};
+    std::vector<value_type> pattern;
+
+    if (default_eq) {
+        std::size_t j = 0;
+
+        for (auto ypos = ybegin; ypos != yend; ++ypos, ++j)
+            peq.insert(details::peq_key(*ypos, 0))[j / 64] |= std::uint64_t{1} << (j % 64);
+    } else {
+        pattern.assign(ybegin, yend);
+    }
+
+    EqualityComparator eq;
+    std::vector<std::uint64_t> zero (blocks);
+    std::vector<std::uint64_t> P (blocks, ~std::uint64_t{0});
+    std::vector<std::uint64_t> M (blocks, 0);
+    auto last = std::uint64_t{1} << ((m - 1) % 64);
+    auto score = ylen;
+
+    for (auto xpos = xbegin; xpos != xend; ++xpos) {
+        auto key = details::peq_key(*xpos, 0);
+        auto Peq = peq.find(key);
+
+        if (Peq == nullptr) {
+            if (default_eq) {
+                Peq = zero.data();
+            } else {
+                auto words = peq.insert(key);
+
+                for (std::size_t j = 0; j < m; j++) {
+                    if (eq(*xpos, pattern[j]))
+                        words[j / 64] |= std::uint64_t{1} << (j % 64);
+                }
+
+                Peq = words;
+            }
+        }
+
+        // Horizontal delta on the top row is +1
+        std::uint64_t hp = 1;
+        std::uint64_t hm = 0;
+
+        for (std::size_t b = 0; b < blocks; b++) {
+            auto Eq = Peq[b];
+            auto Pv = P[b];
+            auto Mv = M[b];
+
+            auto Xv = Eq | Mv;
+            Eq |= hm;
+
+            auto Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+            auto Ph = Mv | ~(Xh | Pv);
+            auto Mh = Pv & Xh;
+
+            auto high = b + 1 < blocks ? std::uint64_t{1} << 63 : last;
+            auto hp_out = (Ph & high) != 0 ? std::uint64_t{1} : std::uint64_t{0};
+            auto hm_out = (Mh & high) != 0 ? std::uint64_t{1} : std::uint64_t{0};
+
+            Ph = (Ph << 1) | hp;
+            Mh = (Mh << 1) | hm;
+
+            P[b] = Mh | ~(Xv | Ph);
+            M[b] = Ph & Xv;
+
+            hp = hp_out;
+            hm = hm_out;
+        }
+
+        score += static_cast<difference_type>(hp) - static_cast<difference_type>(hm);
+    }
+
+    return score;
+}
+
 //
 // Limitations:
 //      1. only equal sized (or empty) sequences are applicable.
@@ -436,6 +655,9 @@ levenshtein_distance (ForwardIter xbegin, ForwardIter xend
         case levenshtein_distance_algo::myers1999:
             return levenshtein_distance_myers1999<ForwardIter, EqualityComparator>(
                 xbegin, xend, ybegin, yend);
+        case levenshtein_distance_algo::hyyro2003:
+            return levenshtein_distance_hyyro2003<ForwardIter, EqualityComparator>(
+                xbegin, xend, ybegin, yend);
         case levenshtein_distance_algo::hamming:
             return levenshtein_distance_hamming<ForwardIter, EqualityComparator>(
                 xbegin, xend, ybegin, yend);
@@ -504,4 +726,17 @@ struct levenshtein_distance_env<ForwardIter, EqualityComparator, levenshtein_dis
     }
 };
 
+template <typename ForwardIter
+    , typename EqualityComparator>
+struct levenshtein_distance_env<ForwardIter, EqualityComparator, levenshtein_distance_algo::hyyro2003>
+{
+    inline typename std::iterator_traits<ForwardIter>::difference_type
+    operator () (ForwardIter xbegin, ForwardIter xend
+        , ForwardIter ybegin, ForwardIter yend) const
+    {
+        return levenshtein_distance_hyyro2003<ForwardIter, EqualityComparator>(
+            xbegin, xend, ybegin, yend);
+    }
+};
+
 } // namespace pfs
@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "error.hpp"
+#include "filesystem.hpp"
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <utility>
+
+#if _MSC_VER
+#   include "windows.hpp"
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <sys/types.h>
+#   include <unistd.h>
+#endif
+
+namespace pfs {
+namespace filesystem {
+
+/**
+ * Read-only memory-mapped file (RAII).
+ *
+ * Mapped content can be passed directly to the consumers accepting a memory range,
+ * e.g. binary_istream(char const *, std::size_t) or crypto::sha256::digest(char const *, std::size_t).
+ */
+class mapped_file final
+{
+public:
+    enum class access_hint {
+          normal
+        , sequential // Data will be accessed sequentially, read ahead aggressively
+        , random     // Data will be accessed in random order, disable read ahead
+    };
+
+private:
+    char const * _data {nullptr};
+    std::size_t _size {0};
+
+private:
+    static char const * empty_data () noexcept
+    {
+        return "";
+    }
+
+    bool open (path const & p, access_hint hint, std::error_code & ec) noexcept
+    {
+#if _MSC_VER
+        HANDLE hfile = CreateFileW(p.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING
+            , hint == access_hint::sequential
+                ? FILE_FLAG_SEQUENTIAL_SCAN
+                : hint == access_hint::random ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL
+            , nullptr);
+
+        if (hfile == INVALID_HANDLE_VALUE) {
+            ec = get_last_system_error();
+            return false;
+        }
+
+        LARGE_INTEGER file_size;
+
+        if (!GetFileSizeEx(hfile, & file_size)) {
+            ec = get_last_system_error();
+            CloseHandle(hfile);
+            return false;
+        }
+
+        if (static_cast<std::uint64_t>(file_size.QuadPart) > (std::numeric_limits<std::size_t>::max)()) {
+            ec = std::make_error_code(std::errc::file_too_large);
+            CloseHandle(hfile);
+            return false;
+        }
+
+        if (file_size.QuadPart == 0) {
+            CloseHandle(hfile);
+            _data = empty_data();
+            _size = 0;
+            return true;
+        }
+
+        HANDLE hmapping = CreateFileMappingW(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (hmapping == nullptr) {
+            ec = get_last_system_error();
+            CloseHandle(hfile);
+            return false;
+        }
+
+        // The view keeps the mapping and the file alive, so handles can be closed right away
+        auto addr = MapViewOfFile(hmapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (addr == nullptr)
+            ec = get_last_system_error();
+
+        CloseHandle(hmapping);
+        CloseHandle(hfile);
+
+        if (addr == nullptr)
+            return false;
+
+        _data = static_cast<char const *>(addr);
+        _size = static_cast<std::size_t>(file_size.QuadPart);
+#else // POSIX
+        int fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0) {
+            ec = get_last_system_error();
+            return false;
+        }
+
+        struct stat st;
+
+        if (::fstat(fd, & st) < 0) {
+            ec = get_last_system_error();
+            ::close(fd);
+            return false;
+        }
+
+        if (static_cast<std::uint64_t>(st.st_size) > (std::numeric_limits<std::size_t>::max)()) {
+            ec = std::make_error_code(std::errc::file_too_large);
+            ::close(fd);
+            return false;
+        }
+
+        auto size = static_cast<std::size_t>(st.st_size);
+
+        if (size == 0) {
+            ::close(fd);
+            _data = empty_data();
+            _size = 0;
+            return true;
+        }
+
+        auto addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (addr == MAP_FAILED)
+            ec = get_last_system_error();
+
+        // The mapping keeps a reference to the file, so descriptor can be closed right away
+        ::close(fd);
+
+        if (addr == MAP_FAILED)
+            return false;
+
+        // Hints are advisory only, so errors are ignored
+        switch (hint) {
+            case access_hint::sequential:
+                ::madvise(addr, size, MADV_SEQUENTIAL);
+                ::madvise(addr, size, MADV_WILLNEED);
+                break;
+            case access_hint::random:
+                ::madvise(addr, size, MADV_RANDOM);
+                break;
+            default:
+                break;
+        }
+
+        _data = static_cast<char const *>(addr);
+        _size = size;
+#endif
+        return true;
+    }
+
+    void close () noexcept
+    {
+        if (_data != nullptr && _size > 0) {
+#if _MSC_VER
+            UnmapViewOfFile(_data);
+#else
+            ::munmap(const_cast<char *>(_data), _size);
+#endif
+        }
+
+        _data = nullptr;
+        _size = 0;
+    }
+
+public:
+    mapped_file () = default;
+
+    mapped_file (path const & p, access_hint hint, std::error_code & ec) noexcept
+    {
+        open(p, hint, ec);
+    }
+
+    mapped_file (path const & p, std::error_code & ec) noexcept
+    {
+        open(p, access_hint::sequential, ec);
+    }
+
+    /**
+     * @throws error with system error code on failure.
+     */
+    explicit mapped_file (path const & p, access_hint hint = access_hint::sequential)
+    {
+        std::error_code ec;
+        open(p, hint, ec);
+
+        if (ec)
+            throw error {ec, utf8_encode_path(p)};
+    }
+
+    mapped_file (mapped_file const &) = delete;
+    mapped_file & operator = (mapped_file const &) = delete;
+
+    mapped_file (mapped_file && other) noexcept
+        : _data(other._data)
+        , _size(other._size)
+    {
+        other._data = nullptr;
+        other._size = 0;
+    }
+
+    mapped_file & operator = (mapped_file && other) noexcept
+    {
+        if (this != & other) {
+            close();
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+        }
+
+        return *this;
+    }
+
+    ~mapped_file ()
+    {
+        close();
+    }
+
+    /**
+     * Checks if file is mapped successfully (an empty file is mapped successfully too).
+     */
+    operator bool () const noexcept
+    {
+        return _data != nullptr;
+    }
+
+    char const * data () const noexcept
+    {
+        return _data;
+    }
+
+    std::size_t size () const noexcept
+    {
+        return _size;
+    }
+
+    bool empty () const noexcept
+    {
+        return _size == 0;
+    }
+
+    char const * begin () const noexcept
+    {
+        return _data;
+    }
+
+    char const * end () const noexcept
+    {
+        return _data + _size;
+    }
+};
+
+}} // namespace pfs::filesystem
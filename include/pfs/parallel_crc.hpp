@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "crc32.hpp"
+#include "crc64.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// Minimal chunk size processed by a separate thread
+#ifndef PFS__PARALLEL_CRC_MIN_CHUNK
+#   define PFS__PARALLEL_CRC_MIN_CHUNK (256 * 1024)
+#endif
+
+namespace pfs {
+
+namespace details {
+
+template <typename T, typename CrcOfPtr, typename CrcCombine>
+T parallel_crc (void const * pdata, std::size_t nbytes, T initial, unsigned nthreads
+    , CrcOfPtr crc_of_ptr, CrcCombine crc_combine)
+{
+    if (nthreads == 0)
+        nthreads = (std::max)(1u, std::thread::hardware_concurrency());
+
+    auto max_chunks = (std::max)(std::size_t{1}, nbytes / PFS__PARALLEL_CRC_MIN_CHUNK);
+    auto nchunks = static_cast<unsigned>((std::min)(static_cast<std::size_t>(nthreads), max_chunks));
+
+    if (pdata == nullptr || nchunks <= 1)
+        return crc_of_ptr(pdata, nbytes, initial);
+
+    auto pbytes = static_cast<std::uint8_t const *>(pdata);
+    auto chunk_size = nbytes / nchunks;
+    std::vector<T> crcs(nchunks);
+    std::vector<std::thread> threads;
+    threads.reserve(nchunks - 1);
+
+    // First chunk is processed by the calling thread
+    unsigned i = 1;
+
+    for (; i < nchunks; i++) {
+        auto offset = i * chunk_size;
+        auto size = (i == nchunks - 1) ? nbytes - offset : chunk_size;
+
+        try {
+            threads.emplace_back([& crcs, crc_of_ptr, pbytes, offset, size, i] {
+                crcs[i] = crc_of_ptr(pbytes + offset, size, T{0});
+            });
+        } catch (std::system_error const &) {
+            // Failed to start the thread, remaining chunks are processed by the calling thread
+            break;
+        }
+    }
+
+    crcs[0] = crc_of_ptr(pbytes, chunk_size, initial);
+
+    for (; i < nchunks; i++) {
+        auto offset = i * chunk_size;
+        auto size = (i == nchunks - 1) ? nbytes - offset : chunk_size;
+        crcs[i] = crc_of_ptr(pbytes + offset, size, T{0});
+    }
+
+    for (auto & t: threads)
+        t.join();
+
+    auto result = crcs[0];
+
+    for (unsigned i = 1; i < nchunks; i++) {
+        auto size = (i == nchunks - 1) ? nbytes - i * chunk_size : chunk_size;
+        result = crc_combine(result, crcs[i], size);
+    }
+
+    return result;
+}
+
+} // namespace details
+
+/**
+ * @brief Calculates the CRC32 checksum splitting data into chunks processed by separate threads.
+ *        Result is the same as returned by @c crc32_of_ptr.
+ *
+ * @param nthreads Maximum number of threads (including the calling one), zero means
+ *        the number of hardware threads.
+ */
+inline std::int32_t parallel_crc32 (void const * pdata, std::size_t nbytes, unsigned nthreads = 0
+    , std::int32_t initial = 0)
+{
+    return details::parallel_crc<std::int32_t>(pdata, nbytes, initial, nthreads
+        , [] (void const * p, std::size_t n, std::int32_t r) { return crc32_of_ptr(p, n, r); }
+        , crc32_combine);
+}
+
+/**
+ * @brief Calculates the CRC64 checksum splitting data into chunks processed by separate threads.
+ *        Result is the same as returned by @c crc64_of_ptr.
+ *
+ * @param nthreads Maximum number of threads (including the calling one), zero means
+ *        the number of hardware threads.
+ */
+inline std::int64_t parallel_crc64 (void const * pdata, std::size_t nbytes, unsigned nthreads = 0
+    , std::int64_t initial = 0)
+{
+    return details::parallel_crc<std::int64_t>(pdata, nbytes, initial, nthreads
+        , [] (void const * p, std::size_t n, std::int64_t r) { return crc64_of_ptr(p, n, r); }
+        , crc64_combine);
+}
+
+} // namespace pfs
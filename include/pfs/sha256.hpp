@@ -5,20 +5,33 @@
 //
 // Changelog:
 //      2021.12.06 Initial version.
+//      2026.10.19 Digest of the file is calculated over memory-mapped content.
+//      2026.10.19 Added SHA extensions, AVX2 and SSSE3 backends selected at runtime.
+//      2026.10.19 Added multi-buffer hashing of message batches.
+//      2026.10.19 Added parallel hashing of files (digest_files).
+//      2026.10.19 Digest to/from string conversion uses vectorized hex encoding.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "3rdparty/crypto/colin_persival_sha256.hpp"
 #include "integer.hpp"
 #include "error.hpp"
 #include "filesystem.hpp"
+#include "mapped_file.hpp"
+#include "sha256_compress.hpp"
+#include "sha256_mb.hpp"
 #include "fmt.hpp"
+#include "hex.hpp"
 #include <cstdint>
 #include <cstring>
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <istream>
+#include <memory>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <vector>
 
 namespace pfs {
@@ -38,28 +51,91 @@ public:
     using batch_context_ptr = std::unique_ptr<batch_context>;
 
 private:
-    details::sha256 _hash;
+    details::sha256_compress_func _compress;
+    std::uint64_t _count {0}; // Number of bytes processed
+    std::uint32_t _state[8] = {
+          0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+        , 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    std::uint8_t _buf[64];
 
 public:
-    sha256 () = default;
+    sha256 ()
+        : _compress(details::sha256_compressor(sha256_backend::automatic))
+    {}
+
+    /**
+     * Constructs hash calculator with specified @a backend (the portable one is used if
+     * @a backend is not supported by CPU).
+     */
+    explicit sha256 (sha256_backend backend)
+        : _compress(details::sha256_compressor(backend))
+    {}
 
     void update (std::uint8_t const * chunk, std::size_t len)
     {
-        _hash.update(chunk, len);
+        auto r = static_cast<std::size_t>(_count & 63);
+        _count += len;
+
+        if (r > 0) {
+            auto n = (std::min)(len, 64 - r);
+            std::memcpy(_buf + r, chunk, n);
+            chunk += n;
+            len -= n;
+
+            if (r + n < 64)
+                return;
+
+            _compress(_state, _buf, 1);
+        }
+
+        // Full blocks are compressed directly from the input
+        if (len >= 64) {
+            _compress(_state, chunk, len / 64);
+            chunk += len & ~std::size_t{63};
+            len &= 63;
+        }
+
+        if (len > 0)
+            std::memcpy(_buf, chunk, len);
     }
 
     void update (char const * chunk, std::size_t len)
     {
-        _hash.update(reinterpret_cast<std::uint8_t const *>(chunk), len);
+        update(reinterpret_cast<std::uint8_t const *>(chunk), len);
     }
 
     sha256_digest digest ()
     {
+        auto r = static_cast<std::size_t>(_count & 63);
+        auto bit_count = _count << 3;
+
+        _buf[r++] = 0x80;
+
+        if (r > 56) {
+            std::memset(_buf + r, 0, 64 - r);
+            _compress(_state, _buf, 1);
+            r = 0;
+        }
+
+        std::memset(_buf + r, 0, 56 - r);
+        details::sha256_store_be(_buf + 56, static_cast<std::uint32_t>(bit_count >> 32));
+        details::sha256_store_be(_buf + 60, static_cast<std::uint32_t>(bit_count));
+        _compress(_state, _buf, 1);
+
         sha256_digest result;
-        _hash.final(result.data());
+
+        for (int i = 0; i < 8; i++)
+            details::sha256_store_be(result.data() + i * 4, _state[i]);
+
         return result;
     }
 
+    static bool supported (sha256_backend backend) noexcept
+    {
+        return details::sha256_backend_supported(backend);
+    }
+
 public: // static
     static inline sha256_digest digest (std::uint8_t const * src, std::size_t n) noexcept
     {
@@ -85,10 +161,49 @@ public: // static
         return digest(reinterpret_cast<std::uint8_t const *>(src.data()), src.size());
     }
 
+    static batch_context_ptr make_batch_context ()
+    {
+        return batch_context_ptr{new batch_context};
+    }
+
+    /**
+     * Calculates digests of all messages of the @a batch. Messages are processed in parallel
+     * SIMD lanes (8 with AVX2, 4 with SSE2) if it is faster than hashing them one by one.
+     *
+     * @param out Array of @c batch.size() digests.
+     */
+    static void digest (batch_context const & batch, sha256_digest * out)
+    {
+        auto messages = batch.messages.data();
+        auto n = batch.messages.size();
+
+#if PFS__X86_INTRINSICS_ENABLED
+        // Sequential hashing with SHA extensions outperforms multi-buffer one
+        if (n > 1 && !supported(sha256_backend::shani)) {
+            if (cpu_features().avx2)
+                details::sha256_mb_digest<8>(details::sha256_mb_compress_avx2, messages, n, out);
+            else
+                details::sha256_mb_digest<4>(details::sha256_mb_compress_sse2, messages, n, out);
+
+            return;
+        }
+#endif
+
+        for (std::size_t i = 0; i < n; i++)
+            out[i] = digest(messages[i].first, messages[i].second);
+    }
+
+    static std::vector<sha256_digest> digest (batch_context const & batch)
+    {
+        std::vector<sha256_digest> result(batch.size());
+        digest(batch, result.data());
+        return result;
+    }
+
     static inline sha256_digest digest (std::istream & is, std::error_code & ec) noexcept
     {
         //return details::sha256::digest(is, ec);
-        constexpr std::size_t kBUFSZ = 256;
+        constexpr std::size_t kBUFSZ = 64 * 1024;
         std::vector<std::uint8_t> buffer(kBUFSZ);
 
         sha256 hash;
@@ -134,7 +249,14 @@ public: // static
         return res;
     }
 
+    static sha256_digest digest (filesystem::mapped_file const & mf) noexcept
+    {
+        return digest(mf.data(), mf.size());
+    }
+
     /**
+     * Calculates digest of the file content. The file is memory-mapped, if mapping is not
+     * possible (e.g. for special files) the content is read through the stream.
      */
     static sha256_digest digest (filesystem::path const & path, std::error_code & ec) noexcept
     {
@@ -143,6 +265,12 @@ public: // static
             return sha256_digest{};
         }
 
+        std::error_code mapping_ec;
+        filesystem::mapped_file mf {path, mapping_ec};
+
+        if (!mapping_ec)
+            return digest(mf);
+
         std::ifstream ifs{pfs::utf8_encode_path(path), std::ios::binary};
         return digest(ifs, ec);
     }
@@ -161,6 +289,68 @@ public: // static
 
         return res;
     }
+
+    /**
+     * Calculates digests of the files concurrently. Files are distributed between threads
+     * dynamically, so a large file does not delay the rest.
+     *
+     * @param errors Errors for each file (invalid digest is returned for failed ones).
+     * @param nthreads Maximum number of threads, zero means the number of hardware threads.
+     */
+    static std::vector<sha256_digest> digest_files (std::vector<filesystem::path> const & paths
+        , std::vector<std::error_code> & errors, unsigned nthreads = 0)
+    {
+        std::vector<sha256_digest> result(paths.size());
+        errors.assign(paths.size(), std::error_code{});
+
+        if (nthreads == 0)
+            nthreads = (std::max)(1u, std::thread::hardware_concurrency());
+
+        nthreads = static_cast<unsigned>((std::min)(static_cast<std::size_t>(nthreads), paths.size()));
+
+        std::atomic<std::size_t> next {0};
+
+        auto worker = [& paths, & result, & errors, & next] () {
+            for (auto i = next++; i < paths.size(); i = next++)
+                result[i] = digest(paths[i], errors[i]);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nthreads);
+
+        for (unsigned i = 1; i < nthreads; i++) {
+            try {
+                threads.emplace_back(worker);
+            } catch (std::system_error const &) {
+                // Failed to start the thread, files are hashed by the started ones
+                break;
+            }
+        }
+
+        worker();
+
+        for (auto & t: threads)
+            t.join();
+
+        return result;
+    }
+
+    /**
+     * @throws error for the first failed file.
+     */
+    static std::vector<sha256_digest> digest_files (std::vector<filesystem::path> const & paths
+        , unsigned nthreads = 0)
+    {
+        std::vector<std::error_code> errors;
+        auto result = digest_files(paths, errors, nthreads);
+
+        for (std::size_t i = 0; i < errors.size(); i++) {
+            if (errors[i])
+                throw error {errors[i], utf8_encode_path(paths[i])};
+        }
+
+        return result;
+    }
 };
 
 inline bool is_valid (sha256_digest const & digest) noexcept
@@ -170,23 +360,15 @@ inline bool is_valid (sha256_digest const & digest) noexcept
 
 inline std::string to_string (sha256_digest const & digest)
 {
-    std::string result;
-    result.reserve(64);
-
-    for (int i = 0; i < 32; i++)
-        result += fmt::format("{:02x}", digest[i]);
-
-    return result;
+    return to_hex(digest.data(), digest.size());
 }
 
 inline sha256_digest to_sha256_digest_unsafe (char const * s, std::error_code & ec)
 {
     sha256_digest result;
 
-    for (int i = 0; !ec && i < 32; i++) {
-        result[i] = to_integer<std::uint8_t>(s, s + 2, 16, ec);
-        s += 2;
-    }
+    if (from_hex(s, 64, result.data()) != 64)
+        ec = make_error_code(std::errc::invalid_argument);
 
     return result;
 }
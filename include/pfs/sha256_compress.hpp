@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cpu_features.hpp"
+#include <cstdint>
+#include <cstring>
+
+// Useful links:
+// [FIPS 180-4 Secure Hash Standard](https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf)
+// [Intel SHA Extensions](https://www.intel.com/content/www/us/en/developer/articles/technical/intel-sha-extensions.html)
+// [Fast SHA-256 Implementations on Intel Architecture Processors](https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/sha-256-implementations-paper.pdf)
+
+namespace pfs {
+namespace crypto {
+
+/**
+ * SHA-256 block compression implementations.
+ */
+enum class sha256_backend
+{
+      automatic // Best implementation supported by CPU
+    , portable  // Portable scalar implementation
+    , ssse3     // Message schedule calculated using SSSE3 instructions
+    , avx2      // Message schedules of two blocks calculated at once using AVX2 instructions
+    , shani     // Intel SHA extensions
+};
+
+namespace details {
+
+/**
+ * Compresses @a nblocks 64-byte blocks into the @a state.
+ */
+using sha256_compress_func = void (*) (std::uint32_t state[8], std::uint8_t const * pblocks, std::size_t nblocks);
+
+/**
+ * SHA-256 round constants (aligned for the vector loads).
+ */
+inline std::uint32_t const * sha256_k () noexcept
+{
+    alignas(64) static constexpr std::uint32_t k[64] = {
+          0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5
+        , 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174
+        , 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da
+        , 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967
+        , 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85
+        , 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070
+        , 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3
+        , 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    return k;
+}
+
+inline std::uint32_t sha256_rotr (std::uint32_t x, int n) noexcept
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+inline std::uint32_t sha256_load_be (std::uint8_t const * p) noexcept
+{
+    return (static_cast<std::uint32_t>(p[0]) << 24) | (static_cast<std::uint32_t>(p[1]) << 16)
+        | (static_cast<std::uint32_t>(p[2]) << 8) | static_cast<std::uint32_t>(p[3]);
+}
+
+inline void sha256_store_be (std::uint8_t * p, std::uint32_t w) noexcept
+{
+    p[0] = static_cast<std::uint8_t>(w >> 24);
+    p[1] = static_cast<std::uint8_t>(w >> 16);
+    p[2] = static_cast<std::uint8_t>(w >> 8);
+    p[3] = static_cast<std::uint8_t>(w);
+}
+
+inline void sha256_round (std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t & d
+    , std::uint32_t e, std::uint32_t f, std::uint32_t g, std::uint32_t & h, std::uint32_t wk) noexcept
+{
+    h += (sha256_rotr(e, 6) ^ sha256_rotr(e, 11) ^ sha256_rotr(e, 25)) + ((e & (f ^ g)) ^ g) + wk;
+    d += h;
+    h += (sha256_rotr(a, 2) ^ sha256_rotr(a, 13) ^ sha256_rotr(a, 22)) + ((a & (b | c)) | (b & c));
+}
+
+/**
+ * Performs 64 rounds using precalculated sums of the message schedule and round constants.
+ */
+inline void sha256_rounds (std::uint32_t state[8], std::uint32_t const wk[64]) noexcept
+{
+    auto a = state[0], b = state[1], c = state[2], d = state[3];
+    auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+    // Variables are rotated by renaming instead of moving
+    for (int i = 0; i < 64; i += 8) {
+        sha256_round(a, b, c, d, e, f, g, h, wk[i + 0]);
+        sha256_round(h, a, b, c, d, e, f, g, wk[i + 1]);
+        sha256_round(g, h, a, b, c, d, e, f, wk[i + 2]);
+        sha256_round(f, g, h, a, b, c, d, e, wk[i + 3]);
+        sha256_round(e, f, g, h, a, b, c, d, wk[i + 4]);
+        sha256_round(d, e, f, g, h, a, b, c, wk[i + 5]);
+        sha256_round(c, d, e, f, g, h, a, b, wk[i + 6]);
+        sha256_round(b, c, d, e, f, g, h, a, wk[i + 7]);
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+inline void sha256_compress_portable (std::uint32_t state[8], std::uint8_t const * p, std::size_t nblocks) noexcept
+{
+    std::uint32_t w[64];
+
+    for (; nblocks > 0; nblocks--, p += 64) {
+        for (int i = 0; i < 16; i++)
+            w[i] = sha256_load_be(p + i * 4);
+
+        for (int i = 16; i < 64; i++) {
+            auto s0 = sha256_rotr(w[i - 15], 7) ^ sha256_rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            auto s1 = sha256_rotr(w[i - 2], 17) ^ sha256_rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        for (int i = 0; i < 64; i++)
+            w[i] += sha256_k()[i];
+
+        sha256_rounds(state, w);
+    }
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+PFS__TARGET("ssse3")
+inline __m128i sha256_sig0_128 (__m128i x)
+{
+    return _mm_xor_si128(_mm_xor_si128(
+          _mm_or_si128(_mm_srli_epi32(x, 7), _mm_slli_epi32(x, 25))
+        , _mm_or_si128(_mm_srli_epi32(x, 18), _mm_slli_epi32(x, 14)))
+        , _mm_srli_epi32(x, 3));
+}
+
+PFS__TARGET("ssse3")
+inline __m128i sha256_sig1_128 (__m128i x)
+{
+    return _mm_xor_si128(_mm_xor_si128(
+          _mm_or_si128(_mm_srli_epi32(x, 17), _mm_slli_epi32(x, 15))
+        , _mm_or_si128(_mm_srli_epi32(x, 19), _mm_slli_epi32(x, 13)))
+        , _mm_srli_epi32(x, 10));
+}
+
+/**
+ * Calculates next four words of the message schedule W[t..t+3] from W[t-16..t-1]
+ * (@a x0 .. @a x3). W[t+2] and W[t+3] depend on W[t] and W[t+1], so sigma1 is applied
+ * in two halves.
+ */
+PFS__TARGET("ssse3")
+inline __m128i sha256_schedule_128 (__m128i x0, __m128i x1, __m128i x2, __m128i x3)
+{
+    auto w15 = _mm_alignr_epi8(x1, x0, 4); // W[t-15..t-12]
+    auto w7 = _mm_alignr_epi8(x3, x2, 4);  // W[t-7..t-4]
+    auto w = _mm_add_epi32(_mm_add_epi32(x0, sha256_sig0_128(w15)), w7);
+
+    w = _mm_add_epi32(w, sha256_sig1_128(_mm_srli_si128(x3, 8)));
+    w = _mm_add_epi32(w, _mm_slli_si128(sha256_sig1_128(w), 8));
+
+    return w;
+}
+
+PFS__TARGET("ssse3")
+inline void sha256_compress_ssse3 (std::uint32_t state[8], std::uint8_t const * p, std::size_t nblocks)
+{
+    auto const bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    auto k = reinterpret_cast<__m128i const *>(sha256_k());
+    alignas(16) std::uint32_t wk[64];
+    auto pwk = reinterpret_cast<__m128i *>(wk);
+
+    for (; nblocks > 0; nblocks--, p += 64) {
+        auto x0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p)), bswap);
+        auto x1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16)), bswap);
+        auto x2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 32)), bswap);
+        auto x3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 48)), bswap);
+
+        _mm_store_si128(pwk + 0, _mm_add_epi32(x0, _mm_load_si128(k + 0)));
+        _mm_store_si128(pwk + 1, _mm_add_epi32(x1, _mm_load_si128(k + 1)));
+        _mm_store_si128(pwk + 2, _mm_add_epi32(x2, _mm_load_si128(k + 2)));
+        _mm_store_si128(pwk + 3, _mm_add_epi32(x3, _mm_load_si128(k + 3)));
+
+        for (int i = 4; i < 16; i++) {
+            auto x = sha256_schedule_128(x0, x1, x2, x3);
+            _mm_store_si128(pwk + i, _mm_add_epi32(x, _mm_load_si128(k + i)));
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+            x3 = x;
+        }
+
+        sha256_rounds(state, wk);
+    }
+}
+
+PFS__TARGET("avx2")
+inline __m256i sha256_sig0_256 (__m256i x)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(
+          _mm256_or_si256(_mm256_srli_epi32(x, 7), _mm256_slli_epi32(x, 25))
+        , _mm256_or_si256(_mm256_srli_epi32(x, 18), _mm256_slli_epi32(x, 14)))
+        , _mm256_srli_epi32(x, 3));
+}
+
+PFS__TARGET("avx2")
+inline __m256i sha256_sig1_256 (__m256i x)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(
+          _mm256_or_si256(_mm256_srli_epi32(x, 17), _mm256_slli_epi32(x, 15))
+        , _mm256_or_si256(_mm256_srli_epi32(x, 19), _mm256_slli_epi32(x, 13)))
+        , _mm256_srli_epi32(x, 10));
+}
+
+/**
+ * Same as sha256_schedule_128() for two independent blocks in 128-bit lanes.
+ */
+PFS__TARGET("avx2")
+inline __m256i sha256_schedule_256 (__m256i x0, __m256i x1, __m256i x2, __m256i x3)
+{
+    auto w15 = _mm256_alignr_epi8(x1, x0, 4);
+    auto w7 = _mm256_alignr_epi8(x3, x2, 4);
+    auto w = _mm256_add_epi32(_mm256_add_epi32(x0, sha256_sig0_256(w15)), w7);
+
+    w = _mm256_add_epi32(w, sha256_sig1_256(_mm256_srli_si256(x3, 8)));
+    w = _mm256_add_epi32(w, _mm256_slli_si256(sha256_sig1_256(w), 8));
+
+    return w;
+}
+
+PFS__TARGET("avx2")
+inline __m256i sha256_load2_256 (std::uint8_t const * p, __m256i bswap)
+{
+    auto lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+    auto hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 64));
+    return _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), bswap);
+}
+
+PFS__TARGET("avx2")
+inline void sha256_compress_avx2 (std::uint32_t state[8], std::uint8_t const * p, std::size_t nblocks)
+{
+    auto const bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL
+        , 0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    auto k = reinterpret_cast<__m128i const *>(sha256_k());
+    alignas(16) std::uint32_t wk0[64];
+    alignas(16) std::uint32_t wk1[64];
+    auto pwk0 = reinterpret_cast<__m128i *>(wk0);
+    auto pwk1 = reinterpret_cast<__m128i *>(wk1);
+
+    for (; nblocks >= 2; nblocks -= 2, p += 128) {
+        __m256i x[4] = {
+              sha256_load2_256(p, bswap)
+            , sha256_load2_256(p + 16, bswap)
+            , sha256_load2_256(p + 32, bswap)
+            , sha256_load2_256(p + 48, bswap)
+        };
+
+        for (int i = 0; i < 16; i++) {
+            if (i >= 4) {
+                auto xn = sha256_schedule_256(x[0], x[1], x[2], x[3]);
+                x[0] = x[1];
+                x[1] = x[2];
+                x[2] = x[3];
+                x[3] = xn;
+            }
+
+            auto wk = _mm256_add_epi32(i < 4 ? x[i] : x[3]
+                , _mm256_broadcastsi128_si256(_mm_load_si128(k + i)));
+
+            _mm_store_si128(pwk0 + i, _mm256_castsi256_si128(wk));
+            _mm_store_si128(pwk1 + i, _mm256_extracti128_si256(wk, 1));
+        }
+
+        sha256_rounds(state, wk0);
+        sha256_rounds(state, wk1);
+    }
+
+    if (nblocks > 0)
+        sha256_compress_ssse3(state, p, nblocks);
+}
+
+PFS__TARGET("sha,sse4.1,ssse3")
+inline void sha256_compress_shani (std::uint32_t state[8], std::uint8_t const * p, std::size_t nblocks)
+{
+    auto const bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    auto k = reinterpret_cast<__m128i const *>(sha256_k());
+
+    // State is kept in ABEF/CDGH order as required by SHA256RNDS2
+    auto tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state)), 0xB1); // CDAB
+    auto state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const *>(state + 4)), 0x1B); // EFGH
+    auto state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);   // CDGH
+
+    for (; nblocks > 0; nblocks--, p += 64) {
+        auto abef_save = state0;
+        auto cdgh_save = state1;
+
+        __m128i m[4] = {
+              _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p)), bswap)
+            , _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 16)), bswap)
+            , _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 32)), bswap)
+            , _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 48)), bswap)
+        };
+
+        // Group g performs rounds 4g..4g+3 with message words W[4g..4g+3] stored in m[g % 4]
+        for (int g = 0; g < 16; g++) {
+            auto msg = _mm_add_epi32(m[g & 3], _mm_load_si128(k + g));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+
+            if (g >= 3 && g <= 14) {
+                auto & next = m[(g + 1) & 3];
+                next = _mm_add_epi32(next, _mm_alignr_epi8(m[g & 3], m[(g - 1) & 3], 4));
+                next = _mm_sha256msg2_epu32(next, m[g & 3]);
+            }
+
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+            if (g >= 1 && g <= 12)
+                m[(g - 1) & 3] = _mm_sha256msg1_epu32(m[(g - 1) & 3], m[g & 3]);
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);    // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);    // HGFE
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), state1);
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+inline bool sha256_backend_supported (sha256_backend backend) noexcept
+{
+    switch (backend) {
+        case sha256_backend::automatic:
+        case sha256_backend::portable:
+            return true;
+#if PFS__X86_INTRINSICS_ENABLED
+        case sha256_backend::ssse3:
+            return cpu_features().ssse3;
+        case sha256_backend::avx2:
+            return cpu_features().avx2;
+        case sha256_backend::shani:
+            return cpu_features().sha && cpu_features().sse41 && cpu_features().ssse3;
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * Returns compression function for the @a backend, portable one if @a backend is not supported.
+ */
+inline sha256_compress_func sha256_compressor (sha256_backend backend) noexcept
+{
+    if (!sha256_backend_supported(backend))
+        return sha256_compress_portable;
+
+    switch (backend) {
+#if PFS__X86_INTRINSICS_ENABLED
+        case sha256_backend::ssse3:
+            return sha256_compress_ssse3;
+        case sha256_backend::avx2:
+            return sha256_compress_avx2;
+        case sha256_backend::shani:
+            return sha256_compress_shani;
+#endif
+        case sha256_backend::automatic: {
+            static sha256_compress_func const best
+                = sha256_backend_supported(sha256_backend::shani) ? sha256_compressor(sha256_backend::shani)
+                : sha256_backend_supported(sha256_backend::avx2) ? sha256_compressor(sha256_backend::avx2)
+                : sha256_backend_supported(sha256_backend::ssse3) ? sha256_compressor(sha256_backend::ssse3)
+                : sha256_compress_portable;
+            return best;
+        }
+
+        default:
+            return sha256_compress_portable;
+    }
+}
+
+}}} // namespace pfs::crypto::details
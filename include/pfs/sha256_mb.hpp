@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "cpu_features.hpp"
+#include "sha256_compress.hpp"
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Multi-buffer SHA-256: independent messages are hashed in SIMD lanes, one message per lane.
+//
+// Useful links:
+// [Processing Multiple Buffers in Parallel to Increase Performance on Intel Architecture Processors](https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/communications-ia-multi-buffer-paper.pdf)
+
+namespace pfs {
+namespace crypto {
+namespace details {
+
+/**
+ * Set of independent messages to be hashed at once by sha256::digest(batch_context const &).
+ * Messages are not copied, so data must outlive the context.
+ */
+struct batch_context
+{
+    std::vector<std::pair<std::uint8_t const *, std::size_t>> messages;
+
+    void add (void const * data, std::size_t size)
+    {
+        messages.emplace_back(static_cast<std::uint8_t const *>(data), size);
+    }
+
+    void clear () noexcept
+    {
+        messages.clear();
+    }
+
+    std::size_t size () const noexcept
+    {
+        return messages.size();
+    }
+};
+
+/**
+ * Compresses one block for each lane. State is stored word-major: @a st[i][lane]
+ * is the i-th word of the lane's state.
+ */
+template <int Lanes>
+using sha256_mb_compress_func = void (*) (std::uint32_t (* st)[Lanes], std::uint8_t const * const * blocks);
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+#define PFS__SHA256_MB_KERNEL(NAME, TARGET, LANES, VEC, LOAD, STORE, SET1, ADD, XOR, OR, AND, ANDNOT, SRLI, SLLI) \
+PFS__TARGET(TARGET)                                                                        \
+inline VEC NAME##_rotr (VEC x, int n)                                                      \
+{                                                                                          \
+    return OR(SRLI(x, n), SLLI(x, 32 - n));                                                \
+}                                                                                          \
+                                                                                           \
+PFS__TARGET(TARGET)                                                                        \
+inline void NAME (std::uint32_t (* st)[LANES], std::uint8_t const * const * blocks)        \
+{                                                                                          \
+    alignas(32) std::uint32_t m[16][LANES];                                                \
+                                                                                           \
+    for (int i = 0; i < 16; i++) {                                                         \
+        for (int j = 0; j < LANES; j++)                                                    \
+            m[i][j] = sha256_load_be(blocks[j] + i * 4);                                   \
+    }                                                                                      \
+                                                                                           \
+    VEC a = LOAD(st[0]), b = LOAD(st[1]), c = LOAD(st[2]), d = LOAD(st[3]);                \
+    VEC e = LOAD(st[4]), f = LOAD(st[5]), g = LOAD(st[6]), h = LOAD(st[7]);                \
+    VEC w[16];                                                                             \
+                                                                                           \
+    for (int i = 0; i < 64; i++) {                                                         \
+        VEC wi;                                                                            \
+                                                                                           \
+        if (i < 16) {                                                                      \
+            wi = LOAD(m[i]);                                                               \
+        } else {                                                                           \
+            auto w15 = w[(i - 15) & 15];                                                   \
+            auto w2 = w[(i - 2) & 15];                                                     \
+            auto s0 = XOR(XOR(NAME##_rotr(w15, 7), NAME##_rotr(w15, 18)), SRLI(w15, 3));   \
+            auto s1 = XOR(XOR(NAME##_rotr(w2, 17), NAME##_rotr(w2, 19)), SRLI(w2, 10));    \
+            wi = ADD(ADD(w[i & 15], s0), ADD(w[(i - 7) & 15], s1));                        \
+        }                                                                                  \
+                                                                                           \
+        w[i & 15] = wi;                                                                    \
+                                                                                           \
+        auto S1 = XOR(XOR(NAME##_rotr(e, 6), NAME##_rotr(e, 11)), NAME##_rotr(e, 25));     \
+        auto ch = XOR(AND(e, f), ANDNOT(e, g));                                            \
+        auto t1 = ADD(ADD(ADD(h, S1), ADD(ch, SET1(static_cast<int>(sha256_k()[i])))), wi);  \
+        auto S0 = XOR(XOR(NAME##_rotr(a, 2), NAME##_rotr(a, 13)), NAME##_rotr(a, 22));     \
+        auto maj = OR(AND(a, OR(b, c)), AND(b, c));                                        \
+        auto t2 = ADD(S0, maj);                                                            \
+                                                                                           \
+        h = g;                                                                             \
+        g = f;                                                                             \
+        f = e;                                                                             \
+        e = ADD(d, t1);                                                                    \
+        d = c;                                                                             \
+        c = b;                                                                             \
+        b = a;                                                                             \
+        a = ADD(t1, t2);                                                                   \
+    }                                                                                      \
+                                                                                           \
+    STORE(st[0], ADD(LOAD(st[0]), a));                                                     \
+    STORE(st[1], ADD(LOAD(st[1]), b));                                                     \
+    STORE(st[2], ADD(LOAD(st[2]), c));                                                     \
+    STORE(st[3], ADD(LOAD(st[3]), d));                                                     \
+    STORE(st[4], ADD(LOAD(st[4]), e));                                                     \
+    STORE(st[5], ADD(LOAD(st[5]), f));                                                     \
+    STORE(st[6], ADD(LOAD(st[6]), g));                                                     \
+    STORE(st[7], ADD(LOAD(st[7]), h));                                                     \
+}
+
+#define PFS__SHA256_MB_LOAD128(p) _mm_load_si128(reinterpret_cast<__m128i const *>(p))
+#define PFS__SHA256_MB_STORE128(p, x) _mm_store_si128(reinterpret_cast<__m128i *>(p), x)
+#define PFS__SHA256_MB_LOAD256(p) _mm256_load_si256(reinterpret_cast<__m256i const *>(p))
+#define PFS__SHA256_MB_STORE256(p, x) _mm256_store_si256(reinterpret_cast<__m256i *>(p), x)
+
+PFS__SHA256_MB_KERNEL(sha256_mb_compress_sse2, "sse2", 4, __m128i
+    , PFS__SHA256_MB_LOAD128, PFS__SHA256_MB_STORE128, _mm_set1_epi32, _mm_add_epi32
+    , _mm_xor_si128, _mm_or_si128, _mm_and_si128, _mm_andnot_si128, _mm_srli_epi32, _mm_slli_epi32)
+
+PFS__SHA256_MB_KERNEL(sha256_mb_compress_avx2, "avx2", 8, __m256i
+    , PFS__SHA256_MB_LOAD256, PFS__SHA256_MB_STORE256, _mm256_set1_epi32, _mm256_add_epi32
+    , _mm256_xor_si256, _mm256_or_si256, _mm256_and_si256, _mm256_andnot_si256, _mm256_srli_epi32, _mm256_slli_epi32)
+
+#undef PFS__SHA256_MB_LOAD128
+#undef PFS__SHA256_MB_STORE128
+#undef PFS__SHA256_MB_LOAD256
+#undef PFS__SHA256_MB_STORE256
+#undef PFS__SHA256_MB_KERNEL
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+/**
+ * Hashes @a n messages in @a Lanes lanes. A lane takes the next message as soon as it
+ * finishes the previous one, the final (padding) blocks are prepared in the lane's buffer.
+ *
+ * @param out Array of @a n digests.
+ */
+template <int Lanes, typename Digest>
+void sha256_mb_digest (sha256_mb_compress_func<Lanes> compress
+    , std::pair<std::uint8_t const *, std::size_t> const * messages, std::size_t n
+    , Digest * out)
+{
+    static constexpr std::uint32_t iv[8] = {
+          0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+        , 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    struct lane
+    {
+        std::size_t index;             // Message index
+        std::uint8_t const * p;        // Next full block of the message
+        std::size_t full_blocks;       // Full blocks left
+        std::size_t tail_blocks;       // Padding blocks left (in the tail buffer)
+        std::size_t tail_offset;
+        bool active;
+        alignas(16) std::uint8_t tail[128];
+    };
+
+    alignas(32) std::uint32_t st[8][Lanes];
+    std::uint8_t const * blocks[Lanes];
+    lane lanes[Lanes];
+    std::uint8_t const dummy[64] = {0};
+    std::size_t next = 0;
+    int active_count = 0;
+
+    auto start = [&] (int j) {
+        auto & ln = lanes[j];
+
+        if (next >= n) {
+            ln.active = false;
+            return;
+        }
+
+        auto data = messages[next].first;
+        auto size = messages[next].second;
+        auto r = size % 64;
+
+        ln.index = next++;
+        ln.p = data;
+        ln.full_blocks = size / 64;
+        ln.tail_blocks = r < 56 ? 1 : 2;
+        ln.tail_offset = 0;
+        ln.active = true;
+
+        auto tail_size = ln.tail_blocks * 64;
+        auto bit_count = static_cast<std::uint64_t>(size) << 3;
+
+        if (r > 0)
+            std::memcpy(ln.tail, data + size - r, r);
+
+        ln.tail[r] = 0x80;
+        std::memset(ln.tail + r + 1, 0, tail_size - r - 1 - 8);
+        sha256_store_be(ln.tail + tail_size - 8, static_cast<std::uint32_t>(bit_count >> 32));
+        sha256_store_be(ln.tail + tail_size - 4, static_cast<std::uint32_t>(bit_count));
+
+        for (int i = 0; i < 8; i++)
+            st[i][j] = iv[i];
+
+        active_count++;
+    };
+
+    for (int j = 0; j < Lanes; j++)
+        start(j);
+
+    while (active_count > 0) {
+        for (int j = 0; j < Lanes; j++) {
+            auto & ln = lanes[j];
+            blocks[j] = !ln.active ? dummy
+                : ln.full_blocks > 0 ? ln.p
+                : ln.tail + ln.tail_offset;
+        }
+
+        compress(st, blocks);
+
+        for (int j = 0; j < Lanes; j++) {
+            auto & ln = lanes[j];
+
+            if (!ln.active)
+                continue;
+
+            if (ln.full_blocks > 0) {
+                ln.full_blocks--;
+                ln.p += 64;
+                continue;
+            }
+
+            ln.tail_offset += 64;
+
+            if (--ln.tail_blocks == 0) {
+                for (int i = 0; i < 8; i++)
+                    sha256_store_be(out[ln.index].data() + i * 4, st[i][j]);
+
+                active_count--;
+                start(j);
+            }
+        }
+    }
+}
+
+}}} // namespace pfs::crypto::details
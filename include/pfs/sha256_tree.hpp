@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "assert.hpp"
+#include "error.hpp"
+#include "filesystem.hpp"
+#include "mapped_file.hpp"
+#include "sha256.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace pfs {
+namespace crypto {
+
+/**
+ * Chunked Merkle tree hash over SHA-256.
+ *
+ * Data is split into fixed-size chunks (leaves) hashed independently (in parallel),
+ * leaf digests are combined pairwise up to the root. Leaves and nodes are hashed with
+ * different prefixes (0x00 and 0x01 as in RFC 6962), the last node of the odd-sized level
+ * is promoted to the next level as is. Empty data consists of single empty chunk.
+ *
+ * @note The root digest is not equal to the plain SHA-256 digest of the data.
+ */
+class sha256_tree
+{
+public:
+    static constexpr std::size_t default_chunk_size = 1024 * 1024;
+
+private:
+    std::size_t _chunk_size {default_chunk_size};
+    std::size_t _size {0};
+    std::vector<sha256_digest> _leaves;
+    sha256_digest _root;
+
+private:
+    static sha256_digest leaf_digest (char const * data, std::size_t n)
+    {
+        std::uint8_t const prefix = 0x00;
+        sha256 hash;
+        hash.update(& prefix, 1);
+        hash.update(data, n);
+        return hash.digest();
+    }
+
+    static sha256_digest node_digest (sha256_digest const & left, sha256_digest const & right)
+    {
+        std::uint8_t const prefix = 0x01;
+        sha256 hash;
+        hash.update(& prefix, 1);
+        hash.update(left.data(), left.size());
+        hash.update(right.data(), right.size());
+        return hash.digest();
+    }
+
+    std::size_t chunk_count (std::size_t size) const noexcept
+    {
+        return size == 0 ? 1 : (size + _chunk_size - 1) / _chunk_size;
+    }
+
+    /**
+     * Hashes chunks with specified indices.
+     */
+    static void hash_chunks (char const * data, std::size_t size, std::size_t chunk_size
+        , std::size_t const * indices, std::size_t count, sha256_digest * out, unsigned nthreads)
+    {
+        if (nthreads == 0)
+            nthreads = (std::max)(1u, std::thread::hardware_concurrency());
+
+        nthreads = static_cast<unsigned>((std::min)(static_cast<std::size_t>(nthreads), count));
+
+        std::atomic<std::size_t> next {0};
+
+        auto worker = [=, & next] () {
+            for (auto i = next++; i < count; i = next++) {
+                auto offset = indices[i] * chunk_size;
+                auto n = offset < size ? (std::min)(chunk_size, size - offset) : 0;
+                out[i] = leaf_digest(data + offset, n);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nthreads);
+
+        for (unsigned i = 1; i < nthreads; i++) {
+            // Chunks are taken by the started threads and the calling one, so failure to
+            // start a thread is not an error
+            try {
+                threads.emplace_back(worker);
+            } catch (std::system_error const &) {
+                break;
+            }
+        }
+
+        worker();
+
+        for (auto & t: threads)
+            t.join();
+    }
+
+    void update_root ()
+    {
+        if (_leaves.empty()) {
+            _root = sha256_digest{};
+            return;
+        }
+
+        auto level = _leaves;
+
+        while (level.size() > 1) {
+            std::size_t j = 0;
+
+            for (std::size_t i = 0; i + 1 < level.size(); i += 2)
+                level[j++] = node_digest(level[i], level[i + 1]);
+
+            if (level.size() % 2 != 0)
+                level[j++] = level.back();
+
+            level.resize(j);
+        }
+
+        _root = level.front();
+    }
+
+public:
+    sha256_tree () = default;
+
+    /**
+     * Builds tree for the @a data.
+     *
+     * @param nthreads Maximum number of threads, zero means the number of hardware threads.
+     */
+    sha256_tree (char const * data, std::size_t size, std::size_t chunk_size = default_chunk_size
+        , unsigned nthreads = 0)
+        : _chunk_size(chunk_size)
+        , _size(size)
+    {
+        PFS__TERMINATE(chunk_size > 0, "sha256_tree: chunk size must be greater than zero");
+
+        std::vector<std::size_t> indices(chunk_count(size));
+
+        for (std::size_t i = 0; i < indices.size(); i++)
+            indices[i] = i;
+
+        _leaves.resize(indices.size());
+        hash_chunks(data, size, _chunk_size, indices.data(), indices.size(), _leaves.data(), nthreads);
+        update_root();
+    }
+
+    /**
+     * Builds tree for the memory-mapped content of the file at @a path.
+     */
+    static sha256_tree build (filesystem::path const & path, std::error_code & ec
+        , std::size_t chunk_size = default_chunk_size, unsigned nthreads = 0)
+    {
+        filesystem::mapped_file mf {path, filesystem::mapped_file::access_hint::sequential, ec};
+
+        if (ec)
+            return sha256_tree{};
+
+        return sha256_tree{mf.data(), mf.size(), chunk_size, nthreads};
+    }
+
+    /**
+     * @throws error with system error code on failure.
+     */
+    static sha256_tree build (filesystem::path const & path, std::size_t chunk_size = default_chunk_size
+        , unsigned nthreads = 0)
+    {
+        std::error_code ec;
+        auto tree = build(path, ec, chunk_size, nthreads);
+
+        if (ec)
+            throw error(ec);
+
+        return tree;
+    }
+
+    sha256_digest const & root () const noexcept
+    {
+        return _root;
+    }
+
+    std::vector<sha256_digest> const & leaves () const noexcept
+    {
+        return _leaves;
+    }
+
+    std::size_t chunk_size () const noexcept
+    {
+        return _chunk_size;
+    }
+
+    /**
+     * Size of the data the tree is built for.
+     */
+    std::size_t size () const noexcept
+    {
+        return _size;
+    }
+
+    /**
+     * Rehashes all chunks of the @a data and returns indices of chunks that differ from
+     * the ones the tree is built for (including chunks that were added or removed). The tree
+     * is not modified.
+     */
+    std::vector<std::size_t> verify (char const * data, std::size_t size, unsigned nthreads = 0) const
+    {
+        auto count = chunk_count(size);
+        std::vector<std::size_t> indices(count);
+        std::vector<sha256_digest> leaves(count);
+
+        for (std::size_t i = 0; i < count; i++)
+            indices[i] = i;
+
+        hash_chunks(data, size, _chunk_size, indices.data(), count, leaves.data(), nthreads);
+
+        std::vector<std::size_t> result;
+
+        for (std::size_t i = 0; i < (std::max)(count, _leaves.size()); i++) {
+            if (i >= count || i >= _leaves.size() || leaves[i] != _leaves[i])
+                result.push_back(i);
+        }
+
+        return result;
+    }
+
+    /**
+     * Updates the tree after the range [@a offset, @a offset + @a length) of the data was
+     * modified: only chunks overlapping the range (and the last chunk if the size of the data
+     * changed) are rehashed.
+     *
+     * @param data Modified data.
+     * @param size New size of the data.
+     */
+    void update (char const * data, std::size_t size, std::size_t offset, std::size_t length
+        , unsigned nthreads = 0)
+    {
+        auto old_count = _leaves.size();
+        auto count = chunk_count(size);
+        std::vector<std::size_t> indices;
+
+        if (length > 0 && offset < size) {
+            auto last = (std::min)(offset + length, size) - 1;
+
+            for (auto i = offset / _chunk_size; i <= last / _chunk_size; i++)
+                indices.push_back(i);
+        }
+
+        // Tail chunks affected by the size change
+        if (size != _size) {
+            auto first = (std::min)(chunk_count(_size), count) - 1;
+
+            for (auto i = first; i < count; i++)
+                indices.push_back(i);
+        }
+
+        // Chunks missing in the tree (default constructed tree has no leaves)
+        for (auto i = old_count; i < count; i++)
+            indices.push_back(i);
+
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+        _leaves.resize(count);
+        _size = size;
+
+        std::vector<sha256_digest> digests(indices.size());
+        hash_chunks(data, size, _chunk_size, indices.data(), indices.size(), digests.data(), nthreads);
+
+        for (std::size_t i = 0; i < indices.size(); i++)
+            _leaves[indices[i]] = digests[i];
+
+        if (!indices.empty() || count != old_count)
+            update_root();
+    }
+};
+
+}} // namespace pfs::crypto
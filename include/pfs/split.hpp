@@ -6,9 +6,13 @@
 // Changelog:
 //      2017.01.26 Initial version of pfs/algo/split.hpp
 //      2021.07.06 Refactored.
+//      2026.10.19 Added lazy `split_view`.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "find.hpp"
+#include "string_view.hpp"
+#include <cstring>
+#include <iterator>
 
 namespace pfs {
 
@@ -69,4 +73,152 @@ OutputIt split (OutputIt result
     return result;
 }
 
+/**
+ * Lazy range of tokens of the @a source separated by the @a separator. Tokens are
+ * yielded as string views into the source on demand, so no memory is allocated.
+ * Produces the same tokens as @c split. Source must outlive the range, the range must
+ * outlive its iterators.
+ *
+ * @code
+ * for (auto token: pfs::split_view(line, ',', pfs::keep_empty::yes))
+ *     process(token);
+ * @endcode
+ */
+class split_view
+{
+    string_view _source;
+    string_view _separator;   // Multi-character separator
+    char _ch {0};             // Single character separator
+    bool _single {false};
+    keep_empty _flag;
+
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = string_view const *;
+        using reference = string_view const &;
+
+    private:
+        split_view const * _view {nullptr};
+        char const * _next {nullptr}; // Start of the next token or nullptr after the last one
+        string_view _token;
+        bool _end {true};
+
+    private:
+        friend class split_view;
+
+        iterator (split_view const * view, char const * next)
+            : _view(view)
+            , _next(next)
+            , _end(false)
+        {
+            advance();
+        }
+
+        void advance ()
+        {
+            auto last = _view->_source.data() + _view->_source.size();
+
+            do {
+                if (_next == nullptr) {
+                    _end = true;
+                    _token = string_view{};
+                    return;
+                }
+
+                auto start = _next;
+                auto p = _view->find_separator(start, static_cast<std::size_t>(last - start));
+
+                if (p != nullptr) {
+                    _token = string_view{start, static_cast<std::size_t>(p - start)};
+                    _next = p + (_view->_single ? 1 : _view->_separator.size());
+                } else {
+                    _token = string_view{start, static_cast<std::size_t>(last - start)};
+                    _next = nullptr;
+                }
+            } while (_token.empty() && _view->_flag == keep_empty::no);
+        }
+
+    public:
+        iterator () = default;
+
+        reference operator * () const noexcept
+        {
+            return _token;
+        }
+
+        pointer operator -> () const noexcept
+        {
+            return & _token;
+        }
+
+        iterator & operator ++ ()
+        {
+            advance();
+            return *this;
+        }
+
+        iterator operator ++ (int)
+        {
+            auto result = *this;
+            advance();
+            return result;
+        }
+
+        bool operator == (iterator const & other) const noexcept
+        {
+            return _end == other._end
+                && (_end || (_next == other._next && _token.data() == other._token.data()));
+        }
+
+        bool operator != (iterator const & other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+
+private:
+    char const * find_separator (char const * s, std::size_t n) const noexcept
+    {
+        if (_single)
+            return static_cast<char const *>(std::memchr(s, _ch, n));
+
+        return details::find_chars(s, n, _separator.data(), _separator.size());
+    }
+
+public:
+    split_view (string_view source, string_view separator, keep_empty flag)
+        : _source(source)
+        , _separator(separator)
+        , _flag(flag)
+    {
+        if (separator.size() == 1) {
+            _single = true;
+            _ch = separator[0];
+        }
+    }
+
+    split_view (string_view source, char separator, keep_empty flag)
+        : _source(source)
+        , _ch(separator)
+        , _single(true)
+        , _flag(flag)
+    {}
+
+    iterator begin () const
+    {
+        // Empty source has no tokens (as for `split`)
+        return _source.empty() ? iterator{} : iterator{this, _source.data()};
+    }
+
+    iterator end () const
+    {
+        return iterator{};
+    }
+};
+
 } // namespace pfs
@@ -7,6 +7,7 @@
 //      2024.04.25 Initial version.
 //      2025.01.24 Removed `binary_istream_nt`.
 //      2025.08.12 Removed deprecated functions.
+//      2026.10.19 Support for streamed binary_istream.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "time_point.hpp"
@@ -25,8 +26,8 @@ void pack (binary_ostream<Endianess> & out, utc_time const & t)
     out << ticks;
 }
 
-template <endian Endianess>
-void unpack (binary_istream<Endianess> & in, utc_time & t)
+template <endian Endianess, typename Source>
+void unpack (binary_istream<Endianess, Source> & in, utc_time & t)
 {
     std::int64_t ticks;
     in >> ticks;
@@ -42,8 +43,8 @@ void pack (binary_ostream<Endianess> & out, local_time const & t)
     out << ticks;
 }
 
-template <endian Endianess>
-void unpack (binary_istream<Endianess> & in, local_time & t)
+template <endian Endianess, typename Source>
+void unpack (binary_istream<Endianess, Source> & in, local_time & t)
 {
     std::int64_t ticks;
     in >> ticks;
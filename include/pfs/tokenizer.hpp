@@ -0,0 +1,587 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "bit.hpp"
+#include "cpu_features.hpp"
+#include "split.hpp"
+#include "string_view.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+// Useful links:
+// [Parsing Gigabytes of JSON per Second](https://arxiv.org/abs/1902.08318) (vectorized classification)
+// [RFC 4180: Common Format and MIME Type for Comma-Separated Values (CSV) Files](https://www.rfc-editor.org/rfc/rfc4180)
+
+PFS__NAMESPACE_BEGIN
+
+/**
+ * Set of bytes (256-bit map) with vectorized search of the first member in a string.
+ */
+class char_set
+{
+    std::uint64_t _bits[4] = {0, 0, 0, 0};
+
+    // Nibble lookup tables: byte `c` is a member if (lo[c & 0x0F] & hi[c >> 4]) != 0.
+    // Exact for sets with at most eight distinct high nibbles (`_vectorized` is true).
+    std::uint8_t _lo[16];
+    std::uint8_t _hi[16];
+    bool _vectorized {false};
+
+private:
+    void update_tables () noexcept
+    {
+        int bucket[16];
+        int nbuckets = 0;
+
+        std::memset(_lo, 0, sizeof(_lo));
+        std::memset(_hi, 0, sizeof(_hi));
+
+        for (int h = 0; h < 16; h++) {
+            bucket[h] = -1;
+
+            for (int l = 0; l < 16; l++) {
+                if (contains(static_cast<char>(h * 16 + l))) {
+                    if (bucket[h] < 0) {
+                        if (nbuckets == 8) {
+                            _vectorized = false;
+                            return;
+                        }
+
+                        bucket[h] = nbuckets++;
+                        _hi[h] = static_cast<std::uint8_t>(1 << bucket[h]);
+                    }
+
+                    _lo[l] |= static_cast<std::uint8_t>(1 << bucket[h]);
+                }
+            }
+        }
+
+        _vectorized = true;
+    }
+
+public:
+    char_set () noexcept
+    {
+        update_tables();
+    }
+
+    /**
+     * Constructs set of characters of the @a chars.
+     */
+    explicit char_set (string_view chars) noexcept
+    {
+        for (auto c: chars)
+            set_bit(c);
+
+        update_tables();
+    }
+
+    void insert (char c) noexcept
+    {
+        set_bit(c);
+        update_tables();
+    }
+
+    bool contains (char c) const noexcept
+    {
+        auto u = static_cast<unsigned char>(c);
+        return (_bits[u >> 6] >> (u & 63)) & 1;
+    }
+
+    /**
+     * @return Position of the first member of the set in the string @a s of length @a n
+     *         or @a n if not found.
+     */
+    std::size_t find_first_in (char const * s, std::size_t n) const noexcept;
+
+    /**
+     * @return Bit mask of members among the first @a n (at most 64) characters of @a s.
+     */
+    std::uint64_t match (char const * s, std::size_t n) const noexcept;
+
+private:
+    void set_bit (char c) noexcept
+    {
+        auto u = static_cast<unsigned char>(c);
+        _bits[u >> 6] |= std::uint64_t{1} << (u & 63);
+    }
+
+#if PFS__X86_INTRINSICS_ENABLED
+    std::size_t find_first_in_ssse3 (char const * s, std::size_t n) const noexcept;
+    std::size_t find_first_in_avx2 (char const * s, std::size_t n) const noexcept;
+    std::uint64_t match64_ssse3 (char const * s) const noexcept;
+    std::uint64_t match64_avx2 (char const * s) const noexcept;
+#endif
+
+    std::uint64_t match_scalar (char const * s, std::size_t n) const noexcept
+    {
+        std::uint64_t result = 0;
+
+        for (std::size_t i = 0; i < n; i++)
+            result |= static_cast<std::uint64_t>(contains(s[i])) << i;
+
+        return result;
+    }
+
+    std::size_t find_first_in_scalar (char const * s, std::size_t n) const noexcept
+    {
+        for (std::size_t i = 0; i < n; i++) {
+            if (contains(s[i]))
+                return i;
+        }
+
+        return n;
+    }
+};
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+PFS__TARGET("ssse3")
+inline std::size_t char_set::find_first_in_ssse3 (char const * s, std::size_t n) const noexcept
+{
+    auto lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(_lo));
+    auto hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(_hi));
+    auto mask = _mm_set1_epi8(0x0F);
+    auto zero = _mm_setzero_si128();
+    std::size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i));
+        auto l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+        auto h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+        auto found = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(l, h), zero))) & 0xFFFF;
+
+        if (found != 0)
+            return i + static_cast<std::size_t>(countr_zero(found));
+    }
+
+    return i + find_first_in_scalar(s + i, n - i);
+}
+
+PFS__TARGET("avx2")
+inline std::size_t char_set::find_first_in_avx2 (char const * s, std::size_t n) const noexcept
+{
+    auto lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(_lo)));
+    auto hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(_hi)));
+    auto mask = _mm256_set1_epi8(0x0F);
+    auto zero = _mm256_setzero_si256();
+    std::size_t i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        auto x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s + i));
+        auto l = _mm256_shuffle_epi8(lo, _mm256_and_si256(x, mask));
+        auto h = _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+        auto found = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(l, h), zero)));
+
+        if (found != 0)
+            return i + static_cast<std::size_t>(countr_zero(found));
+    }
+
+    return i + find_first_in_ssse3(s + i, n - i);
+}
+
+PFS__TARGET("ssse3")
+inline std::uint64_t char_set::match64_ssse3 (char const * s) const noexcept
+{
+    auto lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(_lo));
+    auto hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(_hi));
+    auto mask = _mm_set1_epi8(0x0F);
+    auto zero = _mm_setzero_si128();
+    std::uint64_t result = 0;
+
+    for (int i = 0; i < 4; i++) {
+        auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + 16 * i));
+        auto l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+        auto h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+        auto found = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(l, h), zero))) & 0xFFFF;
+        result |= static_cast<std::uint64_t>(found) << (16 * i);
+    }
+
+    return result;
+}
+
+PFS__TARGET("avx2")
+inline std::uint64_t char_set::match64_avx2 (char const * s) const noexcept
+{
+    auto lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(_lo)));
+    auto hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(_hi)));
+    auto mask = _mm256_set1_epi8(0x0F);
+    auto zero = _mm256_setzero_si256();
+    std::uint64_t result = 0;
+
+    for (int i = 0; i < 2; i++) {
+        auto x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s + 32 * i));
+        auto l = _mm256_shuffle_epi8(lo, _mm256_and_si256(x, mask));
+        auto h = _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask));
+        auto found = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(l, h), zero)));
+        result |= static_cast<std::uint64_t>(found) << (32 * i);
+    }
+
+    return result;
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+inline std::uint64_t char_set::match (char const * s, std::size_t n) const noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (n == 64 && _vectorized) {
+        if (cpu_features().avx2)
+            return match64_avx2(s);
+
+        if (cpu_features().ssse3)
+            return match64_ssse3(s);
+    }
+#endif
+
+    return match_scalar(s, n);
+}
+
+inline std::size_t char_set::find_first_in (char const * s, std::size_t n) const noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (_vectorized) {
+        if (cpu_features().avx2)
+            return find_first_in_avx2(s, n);
+
+        if (cpu_features().ssse3)
+            return find_first_in_ssse3(s, n);
+    }
+#endif
+
+    return find_first_in_scalar(s, n);
+}
+
+struct tokenizer_options
+{
+    // Quote character, zero - quoting is disabled. Inside quoted field delimiters lose
+    // their meaning and doubled quote means quote character itself.
+    char quote {'"'};
+
+    // Escape character, zero - escaping is disabled. Character following the escape
+    // loses its special meaning. Ignored if equal to the quote character.
+    char escape {'\0'};
+
+    keep_empty flag {keep_empty::yes};
+};
+
+/**
+ * Field produced by tokenizer.
+ */
+struct token
+{
+    // Field content (without enclosing quotes) as is
+    string_view text;
+
+    // Delimiter that terminated the field or zero for the last field
+    char delimiter {'\0'};
+
+    bool quoted {false};
+
+    // Text contains escape sequences or doubled quotes (see unescape())
+    bool escaped {false};
+};
+
+/**
+ * Lazy range of fields of the @a source separated by any of the delimiters honoring quotes
+ * and escapes. Fields are yielded as views into the source (zero-copy), escaped content
+ * is decoded on demand by unescape(). Produces the same fields as @c split for single
+ * delimiter if quotes and escapes are disabled.
+ *
+ * Quoted field starts with quote character and ends with quote character followed by
+ * a delimiter or end of the source. Field with characters after the closing quote
+ * is returned as is (unquoted). Unterminated quoted field lasts till the end of the source.
+ *
+ * Empty unquoted fields are skipped if @c keep_empty::no specified. Source must outlive
+ * the range, the range must outlive its iterators.
+ */
+class tokenizer
+{
+    string_view _source;
+    char_set _delimiters;
+    char_set _field_specials;  // Delimiters and escape
+    char_set _quoted_specials; // Quote and escape
+    tokenizer_options _opts;
+
+    // Mask of special characters of the 64-byte block of the source, so fields shorter
+    // than the block cost a bit scan.
+    struct scan_cache
+    {
+        std::size_t base {0};
+        std::size_t size {0};
+        std::uint64_t mask {0};
+    };
+
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = token;
+        using difference_type = std::ptrdiff_t;
+        using pointer = token const *;
+        using reference = token const &;
+
+    private:
+        tokenizer const * _tokenizer {nullptr};
+        char const * _next {nullptr}; // Start of the next field or nullptr after the last one
+        token _token;
+        bool _end {true};
+        scan_cache _caches[2]; // For field and quoted field specials
+
+    private:
+        friend class tokenizer;
+
+        iterator (tokenizer const * t, char const * next)
+            : _tokenizer(t)
+            , _next(next)
+            , _end(false)
+        {
+            advance();
+        }
+
+        void advance ()
+        {
+            do {
+                if (_next == nullptr) {
+                    _end = true;
+                    _token = token{};
+                    return;
+                }
+
+                _next = _tokenizer->parse_field(_next, _token, _caches);
+            } while (_tokenizer->_opts.flag == keep_empty::no && _token.text.empty() && !_token.quoted);
+        }
+
+    public:
+        iterator () = default;
+
+        reference operator * () const noexcept
+        {
+            return _token;
+        }
+
+        pointer operator -> () const noexcept
+        {
+            return & _token;
+        }
+
+        iterator & operator ++ ()
+        {
+            advance();
+            return *this;
+        }
+
+        iterator operator ++ (int)
+        {
+            auto result = *this;
+            advance();
+            return result;
+        }
+
+        bool operator == (iterator const & other) const noexcept
+        {
+            return _end == other._end
+                && (_end || (_next == other._next && _token.text.data() == other._token.text.data()));
+        }
+
+        bool operator != (iterator const & other) const noexcept
+        {
+            return !(*this == other);
+        }
+    };
+
+private:
+    /**
+     * @return Pointer to the first member of the @a set starting from @a p or end of the source.
+     */
+    char const * find_special (char_set const & set, char const * p, scan_cache & cache) const noexcept
+    {
+        auto pos = static_cast<std::size_t>(p - _source.data());
+
+        for (;;) {
+            // Wraps around if `pos` is before the block
+            auto offset = pos - cache.base;
+
+            if (offset < cache.size) {
+                auto m = cache.mask >> offset;
+
+                if (m != 0)
+                    return _source.data() + pos + static_cast<std::size_t>(countr_zero(m));
+
+                pos = cache.base + cache.size;
+            }
+
+            if (pos >= _source.size())
+                return _source.data() + _source.size();
+
+            cache.base = pos;
+            cache.size = (std::min)(std::size_t{64}, _source.size() - pos);
+            cache.mask = set.match(_source.data() + pos, cache.size);
+        }
+    }
+
+    /**
+     * Parses unquoted field (or the rest of it started at @a p).
+     *
+     * @return Start of the next field or nullptr if the field is the last one.
+     */
+    char const * parse_unquoted (char const * start, char const * p, token & t, scan_cache * caches) const noexcept
+    {
+        auto last = _source.data() + _source.size();
+
+        for (;;) {
+            auto q = find_special(_field_specials, p, caches[0]);
+
+            if (q == last) {
+                t.text = string_view{start, static_cast<std::size_t>(last - start)};
+                t.delimiter = '\0';
+                return nullptr;
+            }
+
+            if (*q == _opts.escape && !_delimiters.contains(*q)) {
+                t.escaped = true;
+                p = (last - q > 1) ? q + 2 : last;
+                continue;
+            }
+
+            t.text = string_view{start, static_cast<std::size_t>(q - start)};
+            t.delimiter = *q;
+            return q + 1;
+        }
+    }
+
+    char const * parse_quoted (char const * start, token & t, scan_cache * caches) const noexcept
+    {
+        auto last = _source.data() + _source.size();
+        auto p = start + 1;
+
+        for (;;) {
+            auto q = find_special(_quoted_specials, p, caches[1]);
+
+            // Unterminated quoted field
+            if (q == last) {
+                t.text = string_view{start + 1, static_cast<std::size_t>(last - start - 1)};
+                t.quoted = true;
+                return nullptr;
+            }
+
+            if (*q == _opts.escape) {
+                t.escaped = true;
+                p = (last - q > 1) ? q + 2 : last;
+                continue;
+            }
+
+            // Doubled quote
+            if (last - q > 1 && q[1] == _opts.quote) {
+                t.escaped = true;
+                p = q + 2;
+                continue;
+            }
+
+            auto after = q + 1;
+
+            if (after == last || _delimiters.contains(*after)) {
+                t.text = string_view{start + 1, static_cast<std::size_t>(q - start - 1)};
+                t.quoted = true;
+                t.delimiter = after == last ? '\0' : *after;
+                return after == last ? nullptr : after + 1;
+            }
+
+            // Characters after the closing quote: the rest of the field is parsed as unquoted
+            return parse_unquoted(start, after, t, caches);
+        }
+    }
+
+    /**
+     * Parses field started at @a start.
+     *
+     * @return Start of the next field or nullptr if the field is the last one.
+     */
+    char const * parse_field (char const * start, token & t, scan_cache * caches) const noexcept
+    {
+        t.quoted = false;
+        t.escaped = false;
+
+        if (_opts.quote != '\0' && start != _source.data() + _source.size() && *start == _opts.quote)
+            return parse_quoted(start, t, caches);
+
+        return parse_unquoted(start, start, t, caches);
+    }
+
+public:
+    tokenizer (string_view source, string_view delimiters, tokenizer_options opts = tokenizer_options{})
+        : _source(source)
+        , _delimiters(delimiters)
+        , _field_specials(delimiters)
+        , _opts(opts)
+    {
+        if (_opts.escape == _opts.quote)
+            _opts.escape = '\0';
+
+        if (_opts.escape != '\0') {
+            _field_specials.insert(_opts.escape);
+            _quoted_specials.insert(_opts.escape);
+        }
+
+        if (_opts.quote != '\0')
+            _quoted_specials.insert(_opts.quote);
+    }
+
+    tokenizer_options const & options () const noexcept
+    {
+        return _opts;
+    }
+
+    iterator begin () const
+    {
+        // Empty source has no fields (as for `split`)
+        return _source.empty() ? iterator{} : iterator{this, _source.data()};
+    }
+
+    iterator end () const
+    {
+        return iterator{};
+    }
+};
+
+/**
+ * Decodes escape sequences and doubled quotes of the token text.
+ */
+inline std::string unescape (token const & t, tokenizer_options const & opts)
+{
+    if (!t.escaped)
+        return std::string(t.text.data(), t.text.size());
+
+    std::string result;
+    result.reserve(t.text.size());
+
+    auto escape = opts.escape == opts.quote ? '\0' : opts.escape;
+    auto p = t.text.data();
+    auto last = p + t.text.size();
+
+    while (p != last) {
+        if (escape != '\0' && *p == escape && last - p > 1) {
+            result += p[1];
+            p += 2;
+        } else if (t.quoted && *p == opts.quote && last - p > 1 && p[1] == opts.quote) {
+            result += opts.quote;
+            p += 2;
+        } else {
+            result += *p++;
+        }
+    }
+
+    return result;
+}
+
+PFS__NAMESPACE_END
@@ -5,16 +5,13 @@
 //
 // Changelog:
 //      20??.??.?? Initial version
+//      2026.10.19 `to_lower`/`to_upper` use built-in case tables instead of ICU and
+//                 `::tolower`/`::toupper`. Added `fold_case`.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include "case_tables.hpp"
 #include <cstdint>
 
-#if PFS__ICU_ENABLED
-#   include <unicode/uchar.h>
-#else
-#   include <cctype>
-#endif
-
 
 namespace pfs {
 namespace unicode {
@@ -141,22 +138,39 @@ inline void invalidate (char_t & c)
     c.value = char_t::max_code_point;
 }
 
+/**
+ * Simple lowercase mapping of the code point (locale independent).
+ */
 inline char_t to_lower (char_t const & c)
 {
-#if PFS__ICU_ENABLED
-    return char_t{u_tolower(static_cast<std::int32_t>(c.value))};
-#else
-    return c.value < 256 ? char_t{::tolower(static_cast<int>(c.value))} : c;
-#endif
+    if (c.value < 0x80)
+        return c.value - 'A' < 26u ? char_t{c.value + 0x20} : c;
+
+    return char_t{c.value + details::case_lookup(c.value).lower};
 }
 
+/**
+ * Simple uppercase mapping of the code point (locale independent).
+ */
 inline char_t to_upper (char_t const & c)
 {
-#if PFS__ICU_ENABLED
-    return char_t{u_toupper(static_cast<std::int32_t>(c.value))};
-#else
-    return c.value < 256 ? char_t{::toupper(static_cast<int>(c.value))} : c;
-#endif
+    if (c.value < 0x80)
+        return c.value - 'a' < 26u ? char_t{c.value - 0x20} : c;
+
+    return char_t{c.value + details::case_lookup(c.value).upper};
+}
+
+/**
+ * Simple case folding of the code point (CaseFolding.txt, statuses C and S): characters
+ * that differ only in case are folded into the same code point (e.g. 'Σ', 'σ' and 'ς').
+ * Use it instead of to_lower() for caseless comparison.
+ */
+inline char_t fold_case (char_t const & c)
+{
+    if (c.value < 0x80)
+        return c.value - 'A' < 26u ? char_t{c.value + 0x20} : c;
+
+    return char_t{c.value + details::case_lookup(c.value).fold};
 }
 
 }} // pfs::unicode
@@ -0,0 +1,371 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "search.hpp"
+#include "utf8_iterator.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pfs {
+namespace unicode {
+
+/**
+ * Searcher of many needles at once (Aho-Corasick automaton over the code points, folded if
+ * case is ignored). The haystack is passed once regardless of the number of needles.
+ *
+ * Code points of the needles are mapped into the compact alphabet (other code points
+ * share the same symbol). If the table of transitions of all states by all symbols is not
+ * too large, the automaton is converted into DFA (one table lookup per character),
+ * otherwise the failure links are followed while searching.
+ */
+class multi_searcher
+{
+    using value_type = char_t::value_type;
+    using state_type = std::uint32_t;
+    using symbol_type = std::uint32_t;
+
+    static constexpr state_type root = 0;
+    static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    // Maximum number of entries of the DFA transition table
+    static constexpr std::size_t dfa_limit = std::size_t{1} << 20;
+
+    // Code points below this value are mapped into the symbols directly
+    static constexpr value_type direct_limit = 0x800;
+
+    bool _ignore_case {false};
+
+    // Alphabet: symbol 0 is any code point not found in the needles
+    std::vector<symbol_type> _direct_symbols;    // for code points below direct_limit
+    std::vector<value_type> _symbols;            // sorted code points above direct_limit
+    std::size_t _direct_count {0};
+    std::size_t _symbol_count {1};
+
+    // Trie transitions (sorted by the symbol for each state) and failure links
+    std::vector<std::uint32_t> _edge_offsets;
+    std::vector<symbol_type> _edge_symbols;
+    std::vector<state_type> _edge_targets;
+    std::vector<state_type> _fail;
+
+    // DFA transitions (empty if the table is too large)
+    std::vector<state_type> _delta;
+
+    // Output: first needle accepted by the state, next needle accepted by the same state,
+    // and the nearest state by failure links that accepts something
+    std::vector<std::uint32_t> _output;
+    std::vector<std::uint32_t> _next_output;
+    std::vector<state_type> _dict;
+
+    std::vector<std::intmax_t> _lengths;         // Needle lengths in code points
+    std::size_t _max_length {0};
+
+private:
+    symbol_type symbol (value_type c) const noexcept
+    {
+        if (c < direct_limit)
+            return _direct_symbols[c];
+
+        auto pos = std::lower_bound(_symbols.begin(), _symbols.end(), c);
+
+        return pos != _symbols.end() && *pos == c
+            ? static_cast<symbol_type>(_direct_count + (pos - _symbols.begin()) + 1)
+            : symbol_type{0};
+    }
+
+    state_type child (state_type s, symbol_type a) const noexcept
+    {
+        auto first = _edge_symbols.begin() + _edge_offsets[s];
+        auto last = _edge_symbols.begin() + _edge_offsets[s + 1];
+        auto pos = std::lower_bound(first, last, a);
+
+        return pos != last && *pos == a ? _edge_targets[pos - _edge_symbols.begin()] : npos;
+    }
+
+    state_type next_state (state_type s, symbol_type a) const noexcept
+    {
+        if (!_delta.empty())
+            return _delta[s * _symbol_count + a];
+
+        if (a == 0)
+            return root;
+
+        for (;;) {
+            auto t = child(s, a);
+
+            if (t != npos)
+                return t;
+
+            if (s == root)
+                return root;
+
+            s = _fail[s];
+        }
+    }
+
+    void build_alphabet (std::vector<std::vector<value_type>> const & needles)
+    {
+        std::vector<value_type> direct;
+
+        for (auto const & needle: needles) {
+            for (auto c: needle)
+                (c < direct_limit ? direct : _symbols).push_back(c);
+        }
+
+        for (auto * v: {& direct, & _symbols}) {
+            std::sort(v->begin(), v->end());
+            v->erase(std::unique(v->begin(), v->end()), v->end());
+        }
+
+        _direct_symbols.assign(direct_limit, 0);
+
+        for (std::size_t i = 0; i < direct.size(); i++)
+            _direct_symbols[direct[i]] = static_cast<symbol_type>(i + 1);
+
+        _direct_count = direct.size();
+        _symbol_count = 1 + _direct_count + _symbols.size();
+    }
+
+    void build (std::vector<std::vector<value_type>> const & needles)
+    {
+        build_alphabet(needles);
+
+        // Trie
+        std::vector<std::vector<std::pair<symbol_type, state_type>>> edges(1);
+
+        _output.assign(1, std::uint32_t{npos});
+        _next_output.assign(needles.size(), std::uint32_t{npos});
+
+        for (std::size_t id = 0; id < needles.size(); id++) {
+            if (needles[id].empty())
+                continue;
+
+            state_type s = root;
+
+            for (auto c: needles[id]) {
+                auto a = symbol(c);
+                auto pos = std::find_if(edges[s].begin(), edges[s].end()
+                    , [a] (std::pair<symbol_type, state_type> const & e) { return e.first == a; });
+
+                if (pos != edges[s].end()) {
+                    s = pos->second;
+                } else {
+                    auto t = static_cast<state_type>(edges.size());
+                    edges[s].emplace_back(a, t);
+                    edges.emplace_back();
+                    _output.push_back(std::uint32_t{npos});
+                    s = t;
+                }
+            }
+
+            // Needles accepted by the same state are reported in order of their identifiers
+            auto * last = & _output[s];
+
+            while (*last != npos)
+                last = & _next_output[*last];
+
+            *last = static_cast<std::uint32_t>(id);
+        }
+
+        auto state_count = edges.size();
+
+        _edge_offsets.assign(state_count + 1, 0);
+        _edge_symbols.clear();
+        _edge_targets.clear();
+
+        for (std::size_t s = 0; s < state_count; s++) {
+            std::sort(edges[s].begin(), edges[s].end());
+
+            for (auto const & e: edges[s]) {
+                _edge_symbols.push_back(e.first);
+                _edge_targets.push_back(e.second);
+            }
+
+            _edge_offsets[s + 1] = static_cast<std::uint32_t>(_edge_symbols.size());
+        }
+
+        // Failure and dictionary links in breadth-first order
+        std::vector<state_type> order;
+        std::deque<state_type> queue {root};
+
+        _fail.assign(state_count, state_type{root});
+        _dict.assign(state_count, state_type{npos});
+
+        while (!queue.empty()) {
+            auto s = queue.front();
+            queue.pop_front();
+            order.push_back(s);
+
+            for (auto const & e: edges[s]) {
+                auto t = e.second;
+
+                if (s != root) {
+                    auto f = _fail[s];
+
+                    while (f != root && child(f, e.first) == npos)
+                        f = _fail[f];
+
+                    auto g = child(f, e.first);
+                    _fail[t] = g != npos ? g : root;
+                }
+
+                auto f = _fail[t];
+                _dict[t] = _output[f] != npos ? f : _dict[f];
+                queue.push_back(t);
+            }
+        }
+
+        _delta.clear();
+
+        if (state_count * _symbol_count <= dfa_limit) {
+            _delta.assign(state_count * _symbol_count, state_type{root});
+
+            // Failure state precedes the state in breadth-first order
+            for (auto s: order) {
+                auto row = & _delta[s * _symbol_count];
+
+                if (s != root)
+                    std::copy_n(& _delta[_fail[s] * _symbol_count], _symbol_count, row);
+
+                for (auto const & e: edges[s])
+                    row[e.first] = e.second;
+            }
+        }
+    }
+
+    template <typename NextChar, typename F>
+    void search (NextChar && next_char, F && on_matched) const
+    {
+        // Ring buffer of the positions in code units of the last characters
+        std::size_t capacity = 1;
+
+        while (capacity <= _max_length)
+            capacity *= 2;
+
+        auto mask = capacity - 1;
+        std::vector<std::intmax_t> positions(capacity);
+
+        state_type s = root;
+        std::intmax_t cp = 0;
+        std::intmax_t cu = 0;
+        value_type c = 0;
+        std::uint8_t n = 0;
+
+        while (next_char(c, n)) {
+            positions[static_cast<std::size_t>(cp) & mask] = cu;
+            cp++;
+            cu += n;
+
+            s = next_state(s, symbol(c));
+
+            if (s == root)
+                continue;
+
+            for (auto t = _output[s] != npos ? s : _dict[s]; t != npos; t = _dict[t]) {
+                for (auto id = _output[t]; id != npos; id = _next_output[id]) {
+                    auto cp_first = cp - _lengths[id];
+                    match_item m {cp_first, cp, positions[static_cast<std::size_t>(cp_first) & mask], cu};
+
+                    if (!on_matched(static_cast<std::size_t>(id), m))
+                        return;
+                }
+            }
+        }
+    }
+
+    template <typename HaystackIt, typename F>
+    void search (HaystackIt first, HaystackIt last, F && on_matched) const
+    {
+        if (_max_length == 0 || first == last)
+            return;
+
+        using contiguous_utf8 = details::is_contiguous_utf8_iterator<HaystackIt>;
+
+        search(details::make_char_reader(first, last, _ignore_case, contiguous_utf8{}), on_matched);
+    }
+
+public:
+    /**
+     * Builds the searcher of the UTF-8 encoded @a needles. Needle identifier is its index
+     * in @a needles. Empty needles never match.
+     *
+     * @throw pfs::error if some needle contains broken UTF-8 sequence.
+     */
+    multi_searcher (std::vector<std::string> const & needles, bool ignore_case)
+        : _ignore_case(ignore_case)
+    {
+        std::vector<std::vector<value_type>> folded;
+        folded.reserve(needles.size());
+
+        for (auto const & needle: needles) {
+            using utf8_iterator = unicode::utf8_iterator<char const *>;
+
+            auto first = utf8_iterator::begin(needle.data(), needle.data() + needle.size());
+            std::vector<value_type> v;
+
+            for (auto pos = first; pos != first.end(); ++pos)
+                v.push_back(ignore_case ? fold_case(*pos).value : (*pos).value);
+
+            _lengths.push_back(static_cast<std::intmax_t>(v.size()));
+            _max_length = (std::max)(_max_length, v.size());
+            folded.push_back(std::move(v));
+        }
+
+        build(folded);
+    }
+
+    /**
+     * Number of the needles.
+     */
+    std::size_t size () const noexcept
+    {
+        return _lengths.size();
+    }
+
+    /**
+     * Searches for the first occurrence (the one that ends first) of any needle in the range
+     * [@a first, @a last).
+     *
+     * @return Pair of the needle identifier and match position specification or
+     *         {size(), {-1, -1, -1, -1}} if nothing found.
+     */
+    template <typename HaystackIt>
+    std::pair<std::size_t, match_item> search_first (HaystackIt first, HaystackIt last) const
+    {
+        std::pair<std::size_t, match_item> result {size(), match_item {-1, -1, -1, -1}};
+
+        search(first, last, [& result] (std::size_t id, match_item const & m) {
+            result = std::make_pair(id, m);
+            return false;
+        });
+
+        return result;
+    }
+
+    /**
+     * Searches for the all occurrences of all needles in the range [@a first, @a last).
+     * Occurrences may overlap, they are reported in order of their ends, the longest first.
+     */
+    template <typename HaystackIt>
+    void search_all (HaystackIt first, HaystackIt last
+        , std::function<void(std::size_t, match_item const &)> on_matched) const
+    {
+        search(first, last, [& on_matched] (std::size_t id, match_item const & m) {
+            on_matched(id, m);
+            return true;
+        });
+    }
+};
+
+}} // namespace pfs::unicode
@@ -5,13 +5,23 @@
 //
 // Changelog:
 //      2023.04.24 Initial version
+//      2026.10.19 Case-insensitive search uses `fold_case`.
+//                 Added `searcher`.
+//                 Character readers moved into `details` for reuse.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "char.hpp"
 #include "traits.hpp"
+#include "transcode.hpp"
+#include "utf8_validate.hpp"
+#include "pfs/find.hpp"
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace pfs {
 namespace unicode {
@@ -83,103 +93,481 @@ struct match_item
     std::intmax_t cu_last;  // last position in code units of the matched subrange (exclusive)
 };
 
+template <typename OctetFwdIt, typename SequencePolicy>
+class utf8_iterator;
+
+namespace details {
+
+template <typename HaystackIt>
+struct is_contiguous_utf8_iterator : std::false_type {};
+
+template <typename OctetFwdIt, typename SequencePolicy>
+struct is_contiguous_utf8_iterator<utf8_iterator<OctetFwdIt, SequencePolicy>>
+    : is_contiguous_octet_iterator<OctetFwdIt>
+{};
+
+inline std::uint8_t fold_ascii (std::uint8_t c) noexcept
+{
+    return static_cast<std::uint8_t>(static_cast<unsigned int>(c - 'A') < 26u ? c + 0x20 : c);
+}
+
 /**
- * Searches for the first occurrence of the sequence of elements
- * [@a s_first, @a s_last) in the range [@a first, @a last).
- *
- * @return Match position specification or {-1, -1, -1, -1} if sequence not found.
+ * Case-insensitive search of the ASCII needle @a n (folded already) of length @a nn
+ * (at least two bytes).
  */
-template <typename HaystackIt, typename NeedleIt>
-match_item search_first (HaystackIt first, HaystackIt last, NeedleIt s_first
-    , NeedleIt s_last, bool ignore_case)
+inline char const * find_ascii_nocase_scalar (char const * h, std::size_t hn, char const * n
+    , std::size_t nn) noexcept
 {
-    if (first == last)
-        return match_item {-1, -1, -1, -1};
+    auto first = static_cast<std::uint8_t>(n[0]);
+    auto last = static_cast<std::uint8_t>(n[nn - 1]);
 
-    if (s_first == s_last)
-        return match_item {-1, -1, -1, -1};
+    for (std::size_t i = 0; i + nn <= hn; i++) {
+        if (fold_ascii(static_cast<std::uint8_t>(h[i])) != first
+                || fold_ascii(static_cast<std::uint8_t>(h[i + nn - 1])) != last) {
+            continue;
+        }
 
-    auto s_dist   = NeedleIt::distance_unsafe(s_first, s_last);
-    auto s_cp_len = s_dist.first;
-    auto s_cu_len = s_dist.second;
+        std::size_t j = 1;
 
-    std::function<bool (pfs::unicode::char_t, pfs::unicode::char_t)> predicate;
-    
-    if (ignore_case)
-        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return pfs::unicode::to_lower(a) == pfs::unicode::to_lower(b); };
-    else
-        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return a == b; };
+        while (j < nn - 1 && fold_ascii(static_cast<std::uint8_t>(h[i + j])) == static_cast<std::uint8_t>(n[j]))
+            j++;
 
-    // Specifying full name to fix ambiguity with std::search
-    auto pos = pfs::unicode::search(first, last, s_first, s_last, predicate);
+        if (j >= nn - 1)
+            return h + i;
+    }
 
-    if (pos != last) {
-        auto res = HaystackIt::distance_unsafe(first, pos);
+    return nullptr;
+}
 
-        return match_item {static_cast<int>(res.first), static_cast<int>(res.first + s_cp_len)
-            , static_cast<int>(res.second), static_cast<int>(res.second + s_cu_len)};
+#if PFS__X86_INTRINSICS_ENABLED
+
+/**
+ * Generic SIMD algorithm (see find_chars_sse2()) with the case of letters ignored: bit 0x20
+ * is set in the haystack octets compared with the letters of the needle.
+ */
+PFS__TARGET("sse2")
+inline char const * find_ascii_nocase_sse2 (char const * h, std::size_t hn, char const * n
+    , std::size_t nn) noexcept
+{
+    auto first = _mm_set1_epi8(n[0]);
+    auto last = _mm_set1_epi8(n[nn - 1]);
+    auto first_mask = _mm_set1_epi8(static_cast<char>(static_cast<unsigned int>(n[0] - 'a') < 26u ? 0x20 : 0));
+    auto last_mask = _mm_set1_epi8(static_cast<char>(static_cast<unsigned int>(n[nn - 1] - 'a') < 26u ? 0x20 : 0));
+    std::size_t i = 0;
+
+    for (; i + nn - 1 + 16 <= hn; i += 16) {
+        auto b0 = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(h + i)), first_mask);
+        auto b1 = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(h + i + nn - 1)), last_mask);
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(first, b0), _mm_cmpeq_epi8(last, b1))));
+
+        while (mask != 0) {
+            auto pos = i + static_cast<std::size_t>(countr_zero(mask));
+            std::size_t j = 1;
+
+            while (j < nn - 1 && fold_ascii(static_cast<std::uint8_t>(h[pos + j])) == static_cast<std::uint8_t>(n[j]))
+                j++;
+
+            if (j >= nn - 1)
+                return h + pos;
+
+            mask &= mask - 1;
+        }
     }
 
-    return match_item {-1, -1, -1, -1};
+    return find_ascii_nocase_scalar(h + i, hn - i, n, nn);
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+inline char const * find_ascii_nocase (char const * h, std::size_t hn, char const * n
+    , std::size_t nn) noexcept
+{
+    if (nn > hn)
+        return nullptr;
+
+    if (nn == 1) {
+        auto c = static_cast<std::uint8_t>(n[0]);
+
+        for (std::size_t i = 0; i < hn; i++) {
+            if (fold_ascii(static_cast<std::uint8_t>(h[i])) == c)
+                return h + i;
+        }
+
+        return nullptr;
+    }
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().sse2)
+        return find_ascii_nocase_sse2(h, hn, n, nn);
+#endif
+
+    return find_ascii_nocase_scalar(h, hn, n, nn);
 }
 
 /**
- * Searches for the all occurrences of the sequence of elements
- * [@a s_first, @a s_last) in the range [@a first, @a last).
+ * Reader of the characters (folded if case is ignored) of the contiguous UTF-8 sequence.
+ * Broken sequences are replaced by U+FFFD of length 1.
  */
-template <typename HaystackIt, typename NeedleIt>
-void search_all (HaystackIt first, HaystackIt last, NeedleIt s_first, NeedleIt s_last
-    , bool ignore_case, std::function<void(match_item const &)> on_matched)
+struct utf8_char_reader
 {
-    if (first == last)
-        return;
+    std::uint8_t const * p;
+    std::uint8_t const * end;
+    bool ignore_case;
+
+    /**
+     * Reads the next character @a c of length @a n in code units. Returns @c false at
+     * the end of the sequence.
+     */
+    bool operator () (char_t::value_type & c, std::uint8_t & n) noexcept
+    {
+        if (p == end)
+            return false;
+
+        char_t::value_type b = *p;
+
+        if (b < 0x80) {
+            c = ignore_case && b - 'A' < 26u ? b + 0x20 : b;
+            n = 1;
+            p++;
+            return true;
+        }
 
-    if (s_first == s_last)
-        return;
+        n = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : 2;
+        c = b & (0x7F >> n);
 
-    auto s_dist   = NeedleIt::distance_unsafe(s_first, s_last);
-    auto s_cp_len = s_dist.first;
-    auto s_cu_len = s_dist.second;
+        bool valid = b >= 0xC0 && b < 0xF8 && end - p >= n;
 
-    std::function<bool (pfs::unicode::char_t, pfs::unicode::char_t)> predicate;
-    
-    if (ignore_case) {
-        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { 
-            return pfs::unicode::to_lower(a) == pfs::unicode::to_lower(b); 
-        };
-    } else {
-        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { 
-            return a == b; 
-        };
+        for (std::uint8_t i = 1; valid && i < n; i++) {
+            valid = (p[i] & 0xC0) == 0x80;
+            c = (c << 6) | (p[i] & 0x3F);
+        }
+
+        if (!valid) {
+            c = char_t::replacement_char;
+            n = 1;
+        } else if (ignore_case) {
+            c = fold_case(char_t{c}).value;
+        }
+
+        p += n;
+        return true;
     }
+};
 
-    match_item m {0, 0, 0, 0};
+/**
+ * Reader of the characters (folded if case is ignored) of the arbitrary UTF iterator.
+ */
+template <typename HaystackIt>
+struct iterator_char_reader
+{
+    HaystackIt first;
+    HaystackIt last;
+    decltype(std::declval<HaystackIt>().base()) base;
+    bool ignore_case;
 
-    auto prev_pos = first;
+    bool operator () (char_t::value_type & c, std::uint8_t & n)
+    {
+        if (first == last)
+            return false;
 
-    // Specifying full name to fix ambiguity with std::search
-    auto pos = pfs::unicode::search(prev_pos, last, s_first, s_last, predicate);
+        c = ignore_case ? fold_case(*first).value : (*first).value;
+        ++first;
 
-    while (pos != last) {
-        auto res = HaystackIt::distance_unsafe(prev_pos, pos);
+        auto next_base = first.base();
+        n = static_cast<std::uint8_t>(std::distance(base, next_base));
+        base = next_base;
+        return true;
+    }
+};
 
-        m.cp_first += res.first;
-        m.cu_first += res.second;
+template <typename HaystackIt>
+inline utf8_char_reader make_char_reader (HaystackIt first, HaystackIt last, bool ignore_case
+    , std::true_type)
+{
+    auto p = octet_pointer(first.base());
+    return utf8_char_reader {p, p + std::distance(first.base(), last.base()), ignore_case};
+}
 
-        m.cp_last += res.first + s_cp_len;
-        m.cu_last += res.second + s_cu_len;
+template <typename HaystackIt>
+inline iterator_char_reader<HaystackIt> make_char_reader (HaystackIt first, HaystackIt last
+    , bool ignore_case, std::false_type)
+{
+    return iterator_char_reader<HaystackIt> {first, last, first.base(), ignore_case};
+}
 
-        NeedleIt::advance_unsafe(pos, s_cp_len);
+} // namespace details
 
-        on_matched(m);
+/**
+ * Searcher of the needle that is prepared once (folded if case is ignored) and reused
+ * for many haystacks.
+ *
+ * Contiguous UTF-8 haystacks are searched on the octets directly if possible: with
+ * @c pfs::find_chars() if the case is significant, and with SIMD filter if the case is
+ * ignored and the needle is ASCII. Otherwise the haystack is decoded once and the window
+ * of the last characters is compared with the needle when its last character matches.
+ * Skip table of Boyer-Moore-Horspool algorithm is not used since every character has to be
+ * decoded anyway to count the code points.
+ *
+ * @note Contiguous UTF-8 haystack is not decoded by the iterator, so its broken sequences
+ *       are not reported (they never match).
+ */
+class searcher
+{
+    using value_type = char_t::value_type;
 
-        prev_pos = pos;
-        m.cp_first += s_cp_len;
-        m.cu_first += s_cu_len;
+    std::vector<value_type> _needle; // Folded if case is ignored
+    std::string _octets;             // Needle in UTF-8 for octet search, empty if not applicable
+    bool _ignore_case {false};
+    bool _ascii_ks {false};          // ASCII needle contains 'k' or 's'
 
-        // Specifying full name to fix ambiguity with std::search
-        pos = pfs::unicode::search(prev_pos, last, s_first, s_last, predicate);
+private:
+    value_type fold (char_t c) const noexcept
+    {
+        return _ignore_case ? fold_case(c).value : c.value;
     }
+
+    static void append_utf8 (std::string & s, value_type c)
+    {
+        if (c < 0x80) {
+            s += static_cast<char>(c);
+        } else if (c < 0x800) {
+            s += static_cast<char>(0xC0 | (c >> 6));
+            s += static_cast<char>(0x80 | (c & 0x3F));
+        } else if (c < 0x10000) {
+            s += static_cast<char>(0xE0 | (c >> 12));
+            s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            s += static_cast<char>(0x80 | (c & 0x3F));
+        } else {
+            s += static_cast<char>(0xF0 | (c >> 18));
+            s += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            s += static_cast<char>(0x80 | (c & 0x3F));
+        }
+    }
+
+    /**
+     * Octet search over the contiguous UTF-8 haystack. Returns @c false if it is not
+     * applicable.
+     */
+    template <typename HaystackIt, typename F>
+    bool search_octets (HaystackIt first, HaystackIt last, F && on_matched, std::true_type) const
+    {
+        if (_octets.empty())
+            return false;
+
+        auto h = reinterpret_cast<char const *>(details::octet_pointer(first.base()));
+        auto hn = static_cast<std::size_t>(std::distance(first.base(), last.base()));
+
+        // Non-ASCII KELVIN SIGN and LATIN SMALL LETTER LONG S are folded into 'k' and 's'
+        if (_ascii_ks && (std::memchr(h, '\xE2', hn) != nullptr || std::memchr(h, '\xC5', hn) != nullptr))
+            return false;
+
+        auto nn = _octets.size();
+        auto cp_len = static_cast<std::intmax_t>(_needle.size());
+        std::size_t offset = 0;
+        std::intmax_t cp = 0;
+
+        while (offset + nn <= hn) {
+            auto p = _ignore_case
+                ? details::find_ascii_nocase(h + offset, hn - offset, _octets.data(), nn)
+                : pfs::details::find_chars(h + offset, hn - offset, _octets.data(), nn);
+
+            if (p == nullptr)
+                break;
+
+            auto pos = static_cast<std::size_t>(p - h);
+            cp += static_cast<std::intmax_t>(utf32_length_from_utf8(h + offset, pos - offset));
+
+            match_item m {cp, cp + cp_len, static_cast<std::intmax_t>(pos)
+                , static_cast<std::intmax_t>(pos + nn)};
+
+            if (!on_matched(m))
+                break;
+
+            cp += cp_len;
+            offset = pos + nn;
+        }
+
+        return true;
+    }
+
+    template <typename HaystackIt, typename F>
+    bool search_octets (HaystackIt, HaystackIt, F &&, std::false_type) const
+    {
+        return false;
+    }
+
+    /**
+     * Compares the needle with the window of the last characters given by @a next_char
+     * (returns @c false at the end of the haystack).
+     */
+    template <typename NextChar, typename F>
+    void search_chars (NextChar && next_char, F && on_matched) const
+    {
+        auto m = _needle.size();
+        std::size_t capacity = 32;
+
+        while (capacity < m)
+            capacity *= 2;
+
+        auto mask = capacity - 1;
+
+        // Ring buffers of the window characters and their lengths in code units
+        value_type small_chars[32];
+        std::uint8_t small_units[32];
+        std::vector<value_type> large_chars;
+        std::vector<std::uint8_t> large_units;
+        value_type * chars = small_chars;
+        std::uint8_t * units = small_units;
+
+        if (m > 32) {
+            large_chars.resize(capacity);
+            large_units.resize(capacity);
+            chars = large_chars.data();
+            units = large_units.data();
+        }
+
+        auto needle = _needle.data();
+        auto last_char = needle[m - 1];
+        std::size_t head = 0;  // Index of the first character of the window
+        std::size_t tail = 0;  // Index after the last character of the window
+        std::intmax_t cp = 0;  // Position of the window in code points
+        std::intmax_t cu = 0;  // Position of the window in code units
+        std::intmax_t cu_window = 0;
+        value_type c = 0;
+        std::uint8_t n = 0;
+
+        while (next_char(c, n)) {
+            chars[tail & mask] = c;
+            units[tail & mask] = n;
+            cu_window += n;
+            tail++;
+
+            if (tail - head > m) {
+                cu_window -= units[head & mask];
+                cu += units[head & mask];
+                cp++;
+                head++;
+            }
+
+            if (c != last_char || tail - head < m)
+                continue;
+
+            std::size_t i = 0;
+
+            while (i < m - 1 && chars[(head + i) & mask] == needle[i])
+                i++;
+
+            if (i == m - 1) {
+                auto mp = static_cast<std::intmax_t>(m);
+
+                if (!on_matched(match_item {cp, cp + mp, cu, cu + cu_window}))
+                    return;
+
+                // Matches do not overlap
+                cp += mp;
+                cu += cu_window;
+                cu_window = 0;
+                head = tail;
+            }
+        }
+    }
+
+    template <typename HaystackIt, typename F>
+    void search (HaystackIt first, HaystackIt last, F && on_matched) const
+    {
+        if (_needle.empty() || first == last)
+            return;
+
+        using contiguous_utf8 = details::is_contiguous_utf8_iterator<HaystackIt>;
+
+        if (!search_octets(first, last, on_matched, contiguous_utf8{}))
+            search_chars(details::make_char_reader(first, last, _ignore_case, contiguous_utf8{}), on_matched);
+    }
+
+public:
+    template <typename NeedleIt>
+    searcher (NeedleIt s_first, NeedleIt s_last, bool ignore_case)
+        : _ignore_case(ignore_case)
+    {
+        bool ascii = true;
+
+        for (; s_first != s_last; ++s_first) {
+            auto c = fold(*s_first);
+            _needle.push_back(c);
+            ascii = ascii && c < 0x80;
+            _ascii_ks = _ascii_ks || c == 'k' || c == 's';
+        }
+
+        // Folded needle can match the haystack characters of the different lengths in
+        // UTF-8, so octets are compared only if the case is significant or needle is ASCII
+        if (!_ignore_case || ascii) {
+            for (auto c: _needle)
+                append_utf8(_octets, c);
+        }
+
+        if (!_ignore_case)
+            _ascii_ks = false;
+    }
+
+    /**
+     * Searches for the first occurrence of the needle in the range [@a first, @a last).
+     *
+     * @return Match position specification or {-1, -1, -1, -1} if sequence not found.
+     */
+    template <typename HaystackIt>
+    match_item search_first (HaystackIt first, HaystackIt last) const
+    {
+        match_item result {-1, -1, -1, -1};
+
+        search(first, last, [& result] (match_item const & m) {
+            result = m;
+            return false;
+        });
+
+        return result;
+    }
+
+    /**
+     * Searches for the all (non-overlapping) occurrences of the needle in the range
+     * [@a first, @a last).
+     */
+    template <typename HaystackIt>
+    void search_all (HaystackIt first, HaystackIt last
+        , std::function<void(match_item const &)> on_matched) const
+    {
+        search(first, last, [& on_matched] (match_item const & m) {
+            on_matched(m);
+            return true;
+        });
+    }
+};
+
+/**
+ * Searches for the first occurrence of the sequence of elements
+ * [@a s_first, @a s_last) in the range [@a first, @a last).
+ *
+ * @return Match position specification or {-1, -1, -1, -1} if sequence not found.
+ *
+ * @note Use @c searcher to search the same needle in many haystacks.
+ */
+template <typename HaystackIt, typename NeedleIt>
+match_item search_first (HaystackIt first, HaystackIt last, NeedleIt s_first
+    , NeedleIt s_last, bool ignore_case)
+{
+    return searcher{s_first, s_last, ignore_case}.search_first(first, last);
+}
+
+/**
+ * Searches for the all occurrences of the sequence of elements
+ * [@a s_first, @a s_last) in the range [@a first, @a last).
+ */
+template <typename HaystackIt, typename NeedleIt>
+void search_all (HaystackIt first, HaystackIt last, NeedleIt s_first, NeedleIt s_last
+    , bool ignore_case, std::function<void(match_item const &)> on_matched)
+{
+    searcher{s_first, s_last, ignore_case}.search_all(first, last, std::move(on_matched));
 }
 
 template <typename HaystackIt, typename NeedleIt>
@@ -199,7 +587,7 @@ match_item search_first (HaystackIt first, HaystackIt last, NeedleIt s_first, Ne
     std::function<bool(pfs::unicode::char_t, pfs::unicode::char_t)> predicate;
 
     if (ignore_case)
-        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return pfs::unicode::to_lower(a) == pfs::unicode::to_lower(b); };
+        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return pfs::unicode::fold_case(a) == pfs::unicode::fold_case(b); };
     else
         predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return a == b; };
 
@@ -234,7 +622,7 @@ void search_all (HaystackIt first, HaystackIt last, NeedleIt s_first, NeedleIt s
     std::function<bool(pfs::unicode::char_t, pfs::unicode::char_t)> predicate;
     
     if (ignore_case)
-        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return pfs::unicode::to_lower(a) == pfs::unicode::to_lower(b); };
+        predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return pfs::unicode::fold_case(a) == pfs::unicode::fold_case(b); };
     else
         predicate = [] (pfs::unicode::char_t a, pfs::unicode::char_t b)->bool { return a == b; };
 
@@ -14,4 +14,22 @@ struct ignore_broken_sequence
     void operator () () const {}
 };
 
+/**
+ * Broken sequence is decoded as U+FFFD REPLACEMENT CHARACTER, decoding continues from the
+ * first octet (code unit) that does not belong to the broken sequence.
+ */
+struct replace_broken_sequence {};
+
+/**
+ * Broken sequence is decoded as U+FFFD REPLACEMENT CHARACTER and the iterator moves to the
+ * end of the sequence, so iteration stops at the first error.
+ */
+struct stop_broken_sequence {};
+
+/**
+ * Sequence is known to be valid (e.g. checked by utf8_validate()), so it is not checked
+ * while decoding.
+ */
+struct unchecked_sequence {};
+
 }} // pfs::unicode
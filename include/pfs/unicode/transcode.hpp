@@ -0,0 +1,739 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "utf8_validate.hpp"
+#include "pfs/bit.hpp"
+#include "pfs/cpu_features.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+// Buffer-to-buffer transcoding between UTF-8, UTF-16 and UTF-32 (in native byte order).
+//
+// The output buffer must be large enough to hold the result, the exact size is calculated by
+// the corresponding `*_length_from_*` function. On invalid input the conversion stops at the
+// first invalid sequence, all preceding characters are converted.
+
+namespace pfs {
+namespace unicode {
+
+struct transcode_result
+{
+    std::size_t read;    // Number of input code units converted (position of the invalid sequence on failure)
+    std::size_t written; // Number of output code units written
+    std::errc ec;        // std::errc::illegal_byte_sequence on invalid input
+};
+
+namespace details {
+
+inline void put_code_point (char16_t *& out, std::uint32_t cp) noexcept
+{
+    if (cp < 0x10000) {
+        *out++ = static_cast<char16_t>(cp);
+    } else {
+        cp -= 0x10000;
+        *out++ = static_cast<char16_t>(0xD800 | (cp >> 10));
+        *out++ = static_cast<char16_t>(0xDC00 | (cp & 0x3FF));
+    }
+}
+
+inline void put_code_point (char32_t *& out, std::uint32_t cp) noexcept
+{
+    *out++ = static_cast<char32_t>(cp);
+}
+
+inline void put_code_point (char *& out, std::uint32_t cp) noexcept
+{
+    if (cp < 0x80) {
+        *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (cp >> 6));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (cp >> 12));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | (cp >> 18));
+        *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+/**
+ * Decodes the code point of the valid multi-byte sequence at @a i and moves @a i after it.
+ */
+inline std::uint32_t decode_utf8_unchecked (std::uint8_t const * p, std::size_t & i) noexcept
+{
+    std::uint32_t b = p[i];
+
+    if (b < 0xE0) {
+        auto cp = ((b & 0x1F) << 6) | (p[i + 1] & 0x3Fu);
+        i += 2;
+        return cp;
+    }
+
+    if (b < 0xF0) {
+        auto cp = ((b & 0x0F) << 12) | ((p[i + 1] & 0x3Fu) << 6) | (p[i + 2] & 0x3Fu);
+        i += 3;
+        return cp;
+    }
+
+    auto cp = ((b & 0x07) << 18) | ((p[i + 1] & 0x3Fu) << 12) | ((p[i + 2] & 0x3Fu) << 6)
+        | (p[i + 3] & 0x3Fu);
+    i += 4;
+    return cp;
+}
+
+/**
+ * Decodes valid UTF-8 sequence.
+ *
+ * @return Number of output code units.
+ */
+template <typename CharT>
+std::size_t utf8_decode_scalar (std::uint8_t const * p, std::size_t n, CharT * out) noexcept
+{
+    auto o = out;
+    std::size_t i = 0;
+
+    while (i < n) {
+        if (p[i] < 0x80)
+            *o++ = static_cast<CharT>(p[i++]);
+        else
+            put_code_point(o, decode_utf8_unchecked(p, i));
+    }
+
+    return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * Encodes code unit(s) at @a i into UTF-8.
+ *
+ * @return @c false if the code unit at @a i is an unpaired surrogate.
+ */
+inline bool utf16_encode_step (char16_t const * s, std::size_t n, std::size_t & i, char *& o) noexcept
+{
+    std::uint32_t u = s[i];
+
+    if ((u & 0xF800) != 0xD800) {
+        put_code_point(o, u);
+        i++;
+        return true;
+    }
+
+    if (u >= 0xDC00 || i + 1 == n || (s[i + 1] & 0xFC00) != 0xDC00)
+        return false;
+
+    put_code_point(o, 0x10000 + ((u - 0xD800) << 10) + (s[i + 1] - 0xDC00u));
+    i += 2;
+    return true;
+}
+
+/**
+ * Encodes code point at @a i into UTF-8.
+ *
+ * @return @c false if the code point is a surrogate or is out of Unicode range.
+ */
+inline bool utf32_encode_step (char32_t const * s, std::size_t & i, char *& o) noexcept
+{
+    std::uint32_t cp = s[i];
+
+    if (cp > 0x10FFFF || (cp & 0xFFFFF800) == 0xD800)
+        return false;
+
+    put_code_point(o, cp);
+    i++;
+    return true;
+}
+
+inline transcode_result utf16_to_utf8_scalar (char16_t const * s, std::size_t n, char * out) noexcept
+{
+    auto o = out;
+    std::size_t i = 0;
+
+    while (i < n) {
+        if (!utf16_encode_step(s, n, i, o))
+            return transcode_result{i, static_cast<std::size_t>(o - out), std::errc::illegal_byte_sequence};
+    }
+
+    return transcode_result{n, static_cast<std::size_t>(o - out), std::errc{}};
+}
+
+inline transcode_result utf32_to_utf8_scalar (char32_t const * s, std::size_t n, char * out) noexcept
+{
+    auto o = out;
+    std::size_t i = 0;
+
+    while (i < n) {
+        if (!utf32_encode_step(s, i, o))
+            return transcode_result{i, static_cast<std::size_t>(o - out), std::errc::illegal_byte_sequence};
+    }
+
+    return transcode_result{n, static_cast<std::size_t>(o - out), std::errc{}};
+}
+
+inline std::size_t utf16_length_from_utf8_scalar (std::uint8_t const * p, std::size_t n) noexcept
+{
+    std::size_t result = 0;
+
+    // Each character except continuation bytes gives one code unit, four-byte sequences
+    // give surrogate pairs
+    for (std::size_t i = 0; i < n; i++)
+        result += static_cast<std::size_t>((p[i] & 0xC0) != 0x80) + static_cast<std::size_t>(p[i] >= 0xF0);
+
+    return result;
+}
+
+inline std::size_t utf32_length_from_utf8_scalar (std::uint8_t const * p, std::size_t n) noexcept
+{
+    std::size_t result = 0;
+
+    for (std::size_t i = 0; i < n; i++)
+        result += static_cast<std::size_t>((p[i] & 0xC0) != 0x80);
+
+    return result;
+}
+
+inline std::size_t utf8_length_from_utf16_scalar (char16_t const * s, std::size_t n) noexcept
+{
+    std::size_t result = 0;
+
+    // Surrogate pair gives four bytes, i.e. two bytes per surrogate
+    for (std::size_t i = 0; i < n; i++) {
+        std::uint32_t u = s[i];
+        result += 1 + static_cast<std::size_t>(u >= 0x80) + static_cast<std::size_t>(u >= 0x800)
+            - static_cast<std::size_t>((u & 0xF800) == 0xD800);
+    }
+
+    return result;
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+PFS__TARGET("sse2")
+inline void widen_ascii (__m128i x, char16_t * o) noexcept
+{
+    auto zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o), _mm_unpacklo_epi8(x, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o + 8), _mm_unpackhi_epi8(x, zero));
+}
+
+PFS__TARGET("sse2")
+inline void widen_ascii (__m128i x, char32_t * o) noexcept
+{
+    auto zero = _mm_setzero_si128();
+    auto lo = _mm_unpacklo_epi8(x, zero);
+    auto hi = _mm_unpackhi_epi8(x, zero);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o), _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o + 4), _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o + 8), _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o + 12), _mm_unpackhi_epi16(hi, zero));
+}
+
+/**
+ * Shuffle masks to compact two-byte UTF-8 sequences (and ASCII characters) encoded from
+ * eight UTF-16 code units: the index is the mask of ASCII code units, the ASCII code unit
+ * gives only the first byte of the pair.
+ *
+ * Sizes are tabulated too since POPCNT is not implied by SSSE3.
+ */
+struct utf16_compact_table
+{
+    std::uint8_t shuffle[256][16];
+    std::uint8_t size[256];
+
+    utf16_compact_table ()
+    {
+        for (int mask = 0; mask < 256; mask++) {
+            int k = 0;
+
+            for (int i = 0; i < 8; i++) {
+                shuffle[mask][k++] = static_cast<std::uint8_t>(2 * i);
+
+                if ((mask & (1 << i)) == 0)
+                    shuffle[mask][k++] = static_cast<std::uint8_t>(2 * i + 1);
+            }
+
+            size[mask] = static_cast<std::uint8_t>(k);
+
+            for (; k < 16; k++)
+                shuffle[mask][k] = 0x80;
+        }
+    }
+};
+
+inline utf16_compact_table const & utf16_compact () noexcept
+{
+    static utf16_compact_table const table;
+    return table;
+}
+
+/**
+ * Shuffle masks to remove 16-bit lanes: the index is the mask of lanes to remove.
+ */
+struct lane_compact_table
+{
+    std::uint8_t shuffle[256][16];
+    std::uint8_t size[256]; // Number of remaining lanes
+
+    lane_compact_table ()
+    {
+        for (int mask = 0; mask < 256; mask++) {
+            int k = 0;
+
+            for (int i = 0; i < 8; i++) {
+                if ((mask & (1 << i)) == 0) {
+                    shuffle[mask][k++] = static_cast<std::uint8_t>(2 * i);
+                    shuffle[mask][k++] = static_cast<std::uint8_t>(2 * i + 1);
+                }
+            }
+
+            size[mask] = static_cast<std::uint8_t>(k / 2);
+
+            for (; k < 16; k++)
+                shuffle[mask][k] = 0x80;
+        }
+    }
+};
+
+inline lane_compact_table const & lane_compact () noexcept
+{
+    static lane_compact_table const table;
+    return table;
+}
+
+PFS__TARGET("sse2")
+inline void store_units (__m128i x, char16_t * o) noexcept
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o), x);
+}
+
+PFS__TARGET("sse2")
+inline void store_units (__m128i x, char32_t * o) noexcept
+{
+    auto zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o), _mm_unpacklo_epi16(x, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(o + 4), _mm_unpackhi_epi16(x, zero));
+}
+
+/**
+ * Decodes valid UTF-8 sequence. Blocks of ASCII characters are widened with SIMD, characters
+ * of eight bytes consisting of ASCII characters and two-byte sequences (U+0080..U+07FF) are
+ * decoded with SIMD too.
+ */
+template <typename CharT>
+PFS__TARGET("ssse3")
+std::size_t utf8_decode_ssse3 (std::uint8_t const * p, std::size_t n, CharT * out) noexcept
+{
+    auto const & table = lane_compact();
+    auto const zero = _mm_setzero_si128();
+    auto const cont_max = _mm_set1_epi8(-64);   // 0xC0
+    auto const two_max = _mm_set1_epi8(-33);    // 0xDF
+    auto const low5 = _mm_set1_epi16(0x1F);
+    auto const low6 = _mm_set1_epi16(0x3F);
+    auto const ascii_max = _mm_set1_epi16(0x80);
+
+    auto o = out;
+    std::size_t i = 0;
+
+    while (i < n) {
+        // At least 32 bytes remain, so there is a room for 8 code units at least in the output
+        if (i + 32 <= n) {
+            auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+            auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(x));
+
+            if (mask == 0) {
+                widen_ascii(x, o);
+                i += 16;
+                o += 16;
+                continue;
+            }
+
+            // No leading bytes of three- and four-byte sequences in the first eight bytes
+            if ((static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(x, two_max))) & mask & 0xFF) == 0) {
+                auto cont = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(cont_max, x))) & 0xFF;
+                auto b0 = _mm_unpacklo_epi8(x, zero);
+                auto b1 = _mm_unpacklo_epi8(_mm_srli_si128(x, 1), zero);
+                auto two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, low5), 6), _mm_and_si128(b1, low6));
+                auto ascii = _mm_cmplt_epi16(b0, ascii_max);
+                auto v = _mm_or_si128(_mm_and_si128(ascii, b0), _mm_andnot_si128(ascii, two));
+
+                // Continuation bytes give no code units
+                v = _mm_shuffle_epi8(v, _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.shuffle[cont])));
+                store_units(v, o);
+                o += table.size[cont];
+
+                // Two-byte sequence started at the last byte is consumed entirely
+                i += 8 + (((mask & ~cont) >> 7) & 1);
+                continue;
+            }
+
+            for (auto end = i + static_cast<std::size_t>(countr_zero(mask)); i < end; i++)
+                *o++ = static_cast<CharT>(p[i]);
+        } else {
+            for (; i < n && p[i] < 0x80; i++)
+                *o++ = static_cast<CharT>(p[i]);
+        }
+
+        // Run of multi-byte sequences
+        while (i < n && p[i] >= 0x80)
+            put_code_point(o, decode_utf8_unchecked(p, i));
+    }
+
+    return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * Blocks of eight code units below U+0800 are encoded with SIMD.
+ */
+PFS__TARGET("ssse3")
+inline transcode_result utf16_to_utf8_ssse3 (char16_t const * s, std::size_t n, char * out) noexcept
+{
+    auto const & table = utf16_compact();
+    auto const zero = _mm_setzero_si128();
+    auto const ascii_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+    auto const two_byte_bits = _mm_set1_epi16(static_cast<short>(0xF800));
+    auto const lead_bits = _mm_set1_epi16(static_cast<short>(0x80C0));
+    auto const low6 = _mm_set1_epi16(0x3F);
+
+    auto o = out;
+    std::size_t i = 0;
+
+    while (i < n) {
+        // At least 16 code units remain, so there is a room for 16 bytes in the output
+        if (i + 16 <= n) {
+            auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i));
+            auto ascii = _mm_cmpeq_epi16(_mm_and_si128(x, ascii_bits), zero);
+
+            if (_mm_movemask_epi8(ascii) == 0xFFFF) {
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(o), _mm_packus_epi16(x, x));
+                i += 8;
+                o += 8;
+                continue;
+            }
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(x, two_byte_bits), zero)) == 0xFFFF) {
+                // 110xxxxx 10xxxxxx in the low and high bytes of each code unit
+                auto pairs = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(x, 6), lead_bits)
+                    , _mm_slli_epi16(_mm_and_si128(x, low6), 8));
+                pairs = _mm_or_si128(_mm_and_si128(ascii, x), _mm_andnot_si128(ascii, pairs));
+
+                auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(ascii, zero)));
+                auto shuffle = _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.shuffle[mask]));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(o), _mm_shuffle_epi8(pairs, shuffle));
+                i += 8;
+                o += table.size[mask];
+                continue;
+            }
+        }
+
+        for (auto end = (std::min)(i + 8, n); i < end; ) {
+            if (!utf16_encode_step(s, n, i, o))
+                return transcode_result{i, static_cast<std::size_t>(o - out), std::errc::illegal_byte_sequence};
+        }
+    }
+
+    return transcode_result{n, static_cast<std::size_t>(o - out), std::errc{}};
+}
+
+/**
+ * Blocks of eight ASCII code points are encoded with SIMD.
+ */
+PFS__TARGET("sse2")
+inline transcode_result utf32_to_utf8_sse2 (char32_t const * s, std::size_t n, char * out) noexcept
+{
+    auto const ascii_bits = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+    auto o = out;
+    std::size_t i = 0;
+
+    while (i < n) {
+        if (i + 8 <= n) {
+            auto x0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i));
+            auto x1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i + 4));
+            auto high = _mm_and_si128(_mm_or_si128(x0, x1), ascii_bits);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFF) {
+                auto x = _mm_packs_epi32(x0, x1);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(o), _mm_packus_epi16(x, x));
+                i += 8;
+                o += 8;
+                continue;
+            }
+        }
+
+        for (auto end = (std::min)(i + 8, n); i < end; ) {
+            if (!utf32_encode_step(s, i, o))
+                return transcode_result{i, static_cast<std::size_t>(o - out), std::errc::illegal_byte_sequence};
+        }
+    }
+
+    return transcode_result{n, static_cast<std::size_t>(o - out), std::errc{}};
+}
+
+/**
+ * Sum of the byte counters (at most 255 each).
+ */
+PFS__TARGET("sse2")
+inline std::size_t horizontal_sum (__m128i counters) noexcept
+{
+    auto sum = _mm_sad_epu8(counters, _mm_setzero_si128());
+    return static_cast<std::size_t>(_mm_cvtsi128_si32(sum)) + static_cast<std::size_t>(_mm_extract_epi16(sum, 4));
+}
+
+// Counters of the matched bytes are accumulated in the byte lanes (comparison gives -1 for
+// match) for at most 255 blocks, so no population count is needed.
+PFS__TARGET("sse2")
+inline std::size_t utf16_length_from_utf8_sse2 (std::uint8_t const * p, std::size_t n) noexcept
+{
+    auto const cont_max = _mm_set1_epi8(-64);  // 0xC0
+    auto const four_min = _mm_set1_epi8(-17);  // 0xEF
+    auto const zero = _mm_setzero_si128();
+    std::size_t result = 0;
+    std::size_t i = 0;
+
+    while (i + 16 <= n) {
+        auto counters = _mm_setzero_si128();
+
+        // Up to two units per byte
+        for (int k = 0; k < 127 && i + 16 <= n; k++, i += 16) {
+            auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+            auto lead = _mm_cmpgt_epi8(x, cont_max);       // ASCII and leading bytes
+            auto four = _mm_and_si128(_mm_cmpgt_epi8(x, four_min), _mm_cmplt_epi8(x, zero));
+            counters = _mm_sub_epi8(_mm_sub_epi8(counters, _mm_or_si128(lead, _mm_cmpeq_epi8(x, cont_max))), four);
+        }
+
+        result += horizontal_sum(counters);
+    }
+
+    return result + utf16_length_from_utf8_scalar(p + i, n - i);
+}
+
+PFS__TARGET("sse2")
+inline std::size_t utf32_length_from_utf8_sse2 (std::uint8_t const * p, std::size_t n) noexcept
+{
+    auto const cont_last = _mm_set1_epi8(-65);  // 0xBF
+    std::size_t result = 0;
+    std::size_t i = 0;
+
+    while (i + 16 <= n) {
+        auto counters = _mm_setzero_si128();
+
+        for (int k = 0; k < 255 && i + 16 <= n; k++, i += 16) {
+            auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+            counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(x, cont_last));
+        }
+
+        result += horizontal_sum(counters);
+    }
+
+    return result + utf32_length_from_utf8_scalar(p + i, n - i);
+}
+
+PFS__TARGET("sse2")
+inline std::size_t utf8_length_from_utf16_sse2 (char16_t const * s, std::size_t n) noexcept
+{
+    auto const zero = _mm_setzero_si128();
+    auto const ascii_bits = _mm_set1_epi16(static_cast<short>(0xFF80));
+    auto const two_byte_bits = _mm_set1_epi16(static_cast<short>(0xF800));
+    auto const surrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+    std::size_t result = 0;
+    std::size_t i = 0;
+
+    while (i + 8 <= n) {
+        auto counters = _mm_setzero_si128();
+
+        // 16-bit counters of the extra bytes (at most two per block)
+        for (int k = 0; k < 8192 && i + 8 <= n; k++, i += 8) {
+            auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + i));
+            auto hi = _mm_and_si128(x, two_byte_bits);
+            auto ge80 = _mm_xor_si128(_mm_cmpeq_epi16(_mm_and_si128(x, ascii_bits), zero), _mm_set1_epi8(-1));
+            auto ge800 = _mm_xor_si128(_mm_cmpeq_epi16(hi, zero), _mm_set1_epi8(-1));
+            auto sur = _mm_cmpeq_epi16(hi, surrogate);
+            counters = _mm_add_epi16(_mm_sub_epi16(_mm_sub_epi16(counters, ge80), ge800), sur);
+            result += 8;
+        }
+
+        auto sum = _mm_madd_epi16(counters, _mm_set1_epi16(1));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+        result += static_cast<std::size_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(sum)));
+    }
+
+    return result + utf8_length_from_utf16_scalar(s + i, n - i);
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+template <typename CharT>
+transcode_result utf8_decode (char const * s, std::size_t n, CharT * out) noexcept
+{
+    auto p = reinterpret_cast<std::uint8_t const *>(s);
+
+    // Validation with SIMD is faster than checks while decoding
+    auto valid = utf8_valid_prefix(p, n);
+    std::size_t written = 0;
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().ssse3)
+        written = utf8_decode_ssse3(p, valid, out);
+    else
+#endif
+        written = utf8_decode_scalar(p, valid, out);
+
+    return transcode_result{valid, written, valid == n ? std::errc{} : std::errc::illegal_byte_sequence};
+}
+
+} // namespace details
+
+/**
+ * Number of UTF-16 code units to encode the UTF-8 sequence (exact for valid sequence, enough
+ * to convert the valid prefix of the invalid one).
+ */
+inline std::size_t utf16_length_from_utf8 (char const * s, std::size_t n) noexcept
+{
+    auto p = reinterpret_cast<std::uint8_t const *>(s);
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().sse2)
+        return details::utf16_length_from_utf8_sse2(p, n);
+#endif
+
+    return details::utf16_length_from_utf8_scalar(p, n);
+}
+
+/**
+ * Number of code points in the UTF-8 sequence.
+ */
+inline std::size_t utf32_length_from_utf8 (char const * s, std::size_t n) noexcept
+{
+    auto p = reinterpret_cast<std::uint8_t const *>(s);
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().sse2)
+        return details::utf32_length_from_utf8_sse2(p, n);
+#endif
+
+    return details::utf32_length_from_utf8_scalar(p, n);
+}
+
+/**
+ * Number of bytes to encode the UTF-16 sequence into UTF-8.
+ */
+inline std::size_t utf8_length_from_utf16 (char16_t const * s, std::size_t n) noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().sse2)
+        return details::utf8_length_from_utf16_sse2(s, n);
+#endif
+
+    return details::utf8_length_from_utf16_scalar(s, n);
+}
+
+/**
+ * Number of bytes to encode the UTF-32 sequence into UTF-8.
+ */
+inline std::size_t utf8_length_from_utf32 (char32_t const * s, std::size_t n) noexcept
+{
+    std::size_t result = 0;
+
+    for (std::size_t i = 0; i < n; i++) {
+        std::uint32_t cp = s[i];
+        result += 1 + static_cast<std::size_t>(cp >= 0x80) + static_cast<std::size_t>(cp >= 0x800)
+            + static_cast<std::size_t>(cp >= 0x10000 && cp <= 0x10FFFF);
+    }
+
+    return result;
+}
+
+/**
+ * Converts UTF-8 sequence into UTF-16, @a out must have room for
+ * utf16_length_from_utf8() code units.
+ */
+inline transcode_result utf8_to_utf16 (char const * s, std::size_t n, char16_t * out) noexcept
+{
+    return details::utf8_decode(s, n, out);
+}
+
+/**
+ * Converts UTF-8 sequence into UTF-32, @a out must have room for
+ * utf32_length_from_utf8() code units.
+ */
+inline transcode_result utf8_to_utf32 (char const * s, std::size_t n, char32_t * out) noexcept
+{
+    return details::utf8_decode(s, n, out);
+}
+
+/**
+ * Converts UTF-16 sequence into UTF-8, @a out must have room for
+ * utf8_length_from_utf16() bytes.
+ */
+inline transcode_result utf16_to_utf8 (char16_t const * s, std::size_t n, char * out) noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().ssse3)
+        return details::utf16_to_utf8_ssse3(s, n, out);
+#endif
+
+    return details::utf16_to_utf8_scalar(s, n, out);
+}
+
+/**
+ * Converts UTF-32 sequence into UTF-8, @a out must have room for
+ * utf8_length_from_utf32() bytes.
+ */
+inline transcode_result utf32_to_utf8 (char32_t const * s, std::size_t n, char * out) noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().sse2)
+        return details::utf32_to_utf8_sse2(s, n, out);
+#endif
+
+    return details::utf32_to_utf8_scalar(s, n, out);
+}
+
+/**
+ * Converts @a s into @a out (the result is truncated at the first invalid sequence).
+ */
+inline transcode_result utf8_to_utf16 (std::string const & s, std::u16string & out)
+{
+    out.resize(utf16_length_from_utf8(s.data(), s.size()));
+    auto result = utf8_to_utf16(s.data(), s.size(), & out[0]);
+    out.resize(result.written);
+    return result;
+}
+
+inline transcode_result utf8_to_utf32 (std::string const & s, std::u32string & out)
+{
+    out.resize(utf32_length_from_utf8(s.data(), s.size()));
+    auto result = utf8_to_utf32(s.data(), s.size(), & out[0]);
+    out.resize(result.written);
+    return result;
+}
+
+inline transcode_result utf16_to_utf8 (std::u16string const & s, std::string & out)
+{
+    out.resize(utf8_length_from_utf16(s.data(), s.size()));
+    auto result = utf16_to_utf8(s.data(), s.size(), & out[0]);
+    out.resize(result.written);
+    return result;
+}
+
+inline transcode_result utf32_to_utf8 (std::u32string const & s, std::string & out)
+{
+    out.resize(utf8_length_from_utf32(s.data(), s.size()));
+    auto result = utf32_to_utf8(s.data(), s.size(), & out[0]);
+    out.resize(result.written);
+    return result;
+}
+
+}} // namespace pfs::unicode
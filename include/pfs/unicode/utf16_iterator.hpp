@@ -5,6 +5,8 @@
 //
 // Changelog:
 //      2020.11.01 Initial version
+//      2026.10.19 `advance(pos, n)` renamed into `skip(pos, last, n)`.
+//                 Added sequence policy parameter.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "../i18n.hpp"
@@ -62,9 +64,14 @@ struct utf16be_byteswap
     }
 };
 
-template <typename HextetFwdIt, typename Utf16ByteSwap>
+/**
+ * @tparam SequencePolicy Handling of the broken sequences: @c except_broken_sequence throws
+ *         error, @c replace_broken_sequence decodes it as U+FFFD and continues,
+ *         @c stop_broken_sequence decodes it as U+FFFD and moves to the end (see broken()).
+ */
+template <typename HextetFwdIt, typename Utf16ByteSwap, typename SequencePolicy = except_broken_sequence>
 class utf16_iterator
-    : public details::utf_iterator<utf16_iterator<HextetFwdIt, Utf16ByteSwap>, HextetFwdIt>
+    : public details::utf_iterator<utf16_iterator<HextetFwdIt, Utf16ByteSwap, SequencePolicy>, HextetFwdIt>
 {
     using base_class = details::utf_iterator<utf16_iterator, HextetFwdIt>;
 
@@ -73,14 +80,22 @@ class utf16_iterator
 public:
     using difference_type = typename base_class::difference_type;
 
+private:
+    char_t::value_type on_broken_sequence (HextetFwdIt & pos, HextetFwdIt last) const
+    {
+        return this->broken_sequence(pos, last, SequencePolicy{});
+    }
+
 protected:
     char_t advance (HextetFwdIt & pos, HextetFwdIt last, difference_type n) const
     {
         char_t::value_type result;
 
         while (n-- > 0) {
-            if (pos == last)
-                throw error {tr::_("broken sequence")};
+            if (pos == last) {
+                result = on_broken_sequence(pos, last);
+                continue;
+            }
 
             std::uint16_t w1 = code_unit_cast<std::uint16_t>(*pos);
             w1 = Utf16ByteSwap::byteswap(w1);
@@ -93,19 +108,24 @@ protected:
             if (w1 < 0xD800 || w1 > 0xDFFF) {
                 ;
             } else if (w1 >= 0xD800 && w1 <= 0xDBFF) {
-                if (pos == last)
-                    throw error {tr::_("broken sequence")};
+                if (pos == last) {
+                    result = on_broken_sequence(pos, last);
+                    continue;
+                }
 
                 w2 = code_unit_cast<std::uint16_t>(*pos);
                 w2 = Utf16ByteSwap::byteswap(w2);
 
-                // Valid unit sequence
-                if (w2 >= 0xDC00 && w2 <= 0xDFFF)
+                // Valid unit sequence, otherwise the unit is left to start the next one
+                if (w2 >= 0xDC00 && w2 <= 0xDFFF) {
                     ++pos;
-                else
-                    throw error {tr::_("broken sequence")};
+                } else {
+                    result = on_broken_sequence(pos, last);
+                    continue;
+                }
             } else {
-                throw error {tr::_("broken sequence")};
+                result = on_broken_sequence(pos, last);
+                continue;
             }
 
             if (w2) {
@@ -123,9 +143,9 @@ protected:
     /**
      * Advance iterator @a pos by @a n code points.
      */
-    void advance (HextetFwdIt & pos, difference_type n) const
+    void skip (HextetFwdIt & pos, HextetFwdIt last, difference_type n) const
     {
-        while (n--) {
+        while (n-- && pos != last) {
             std::uint16_t w1 = code_unit_cast<std::uint16_t>(*pos);
             w1 = Utf16ByteSwap::byteswap(w1);
             ++pos;
@@ -135,7 +155,7 @@ protected:
             } else if (w1 >= 0xD800 && w1 <= 0xDBFF) {
                 ++pos;
             } else {
-                throw error {tr::_("broken sequence")};
+                on_broken_sequence(pos, last);
             }
         }
     }
@@ -164,7 +184,8 @@ protected:
                 cu_count += 2;
                 ++pos;
             } else {
-                throw error {tr::_("broken sequence")};
+                cu_count++;
+                on_broken_sequence(pos, last);
             }
 
             cp_count++;
@@ -177,10 +198,10 @@ public:
     using base_class::base_class;
 };
 
-template <typename HextetFwdIt>
-using utf16le_iterator = utf16_iterator<HextetFwdIt, utf16le_byteswap>;
+template <typename HextetFwdIt, typename SequencePolicy = except_broken_sequence>
+using utf16le_iterator = utf16_iterator<HextetFwdIt, utf16le_byteswap, SequencePolicy>;
 
-template <typename HextetFwdIt>
-using utf16be_iterator = utf16_iterator<HextetFwdIt, utf16be_byteswap>;
+template <typename HextetFwdIt, typename SequencePolicy = except_broken_sequence>
+using utf16be_iterator = utf16_iterator<HextetFwdIt, utf16be_byteswap, SequencePolicy>;
 
 }} // pfs::unicode
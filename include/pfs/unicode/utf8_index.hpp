@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "transcode.hpp"
+#include "utf8_iterator.hpp"
+#include "pfs/bit.hpp"
+#include "pfs/cpu_features.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace pfs {
+namespace unicode {
+
+namespace details {
+
+/**
+ * Offset of the @a k-th (starting from zero) code point in the UTF-8 sequence or @a n if
+ * the sequence contains fewer code points. Code points are counted as the octets that are
+ * not continuation ones.
+ */
+inline std::size_t utf8_skip_scalar (std::uint8_t const * p, std::size_t n, std::size_t k) noexcept
+{
+    for (std::size_t i = 0; i < n; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            if (k == 0)
+                return i;
+
+            k--;
+        }
+    }
+
+    return n;
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+PFS__TARGET("sse2")
+inline std::size_t utf8_skip_sse2 (std::uint8_t const * p, std::size_t n, std::size_t k) noexcept
+{
+    auto const cont_last = _mm_set1_epi8(-65);  // 0xBF
+    std::size_t i = 0;
+
+    // Whole 64-octet chunks preceding the code point
+    while (i + 64 <= n) {
+        auto counters = _mm_setzero_si128();
+
+        for (int j = 0; j < 4; j++) {
+            auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i + 16 * j));
+            counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(x, cont_last));
+        }
+
+        auto count = horizontal_sum(counters);
+
+        if (count > k)
+            break;
+
+        k -= count;
+        i += 64;
+    }
+
+    while (i + 16 <= n) {
+        auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(x, cont_last)));
+        auto count = horizontal_sum(_mm_sub_epi8(_mm_setzero_si128(), _mm_cmpgt_epi8(x, cont_last)));
+
+        if (count > k) {
+            for (; k > 0; k--)
+                mask &= mask - 1;
+
+            return i + static_cast<std::size_t>(countr_zero(mask));
+        }
+
+        k -= count;
+        i += 16;
+    }
+
+    return i + utf8_skip_scalar(p + i, n - i, k);
+}
+#endif
+
+inline std::size_t utf8_skip (char const * s, std::size_t n, std::size_t k) noexcept
+{
+    auto p = reinterpret_cast<std::uint8_t const *>(s);
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().sse2)
+        return utf8_skip_sse2(p, n, k);
+#endif
+
+    return utf8_skip_scalar(p, n, k);
+}
+
+} // namespace details
+
+/**
+ * Sampled index of the code points of the UTF-8 text: the text is split into blocks of at
+ * most @c step() code points, the positions of block starts (in code points and in code
+ * units) are stored. Conversion between the positions in code points and code units
+ * scans at most one block.
+ *
+ * The index does not own the text, so it is passed to each call and must be the same
+ * (modified only as reported by @c replace()) as the indexed one.
+ *
+ * Code points are counted as the octets that are not continuation ones, so the positions
+ * are consistent for the broken sequences too.
+ */
+class utf8_index
+{
+    std::size_t _step {64};
+    std::vector<std::size_t> _cp {0}; // Block starts in code points
+    std::vector<std::size_t> _cu {0}; // Block starts in code units
+    std::size_t _cp_count {0};
+    std::size_t _cu_count {0};
+
+private:
+    // Index of the block containing the code point @a cp
+    std::size_t block_by_code_point (std::size_t cp) const noexcept
+    {
+        return static_cast<std::size_t>(std::upper_bound(_cp.begin(), _cp.end(), cp) - _cp.begin()) - 1;
+    }
+
+    // Index of the block containing the code unit @a cu
+    std::size_t block_by_code_unit (std::size_t cu) const noexcept
+    {
+        return static_cast<std::size_t>(std::upper_bound(_cu.begin(), _cu.end(), cu) - _cu.begin()) - 1;
+    }
+
+    /**
+     * Samples the text range [@a first, @a last) starting at code point @a cp into @a cps and
+     * @a cus, returns the number of code points in the range.
+     */
+    std::size_t sample (char const * s, std::size_t first, std::size_t last, std::size_t cp
+        , std::vector<std::size_t> & cps, std::vector<std::size_t> & cus) const
+    {
+        auto pos = first;
+        auto n = utf32_length_from_utf8(s + first, last - first);
+
+        cps.push_back(cp);
+        cus.push_back(first);
+
+        for (std::size_t i = _step; i < n; i += _step) {
+            pos += details::utf8_skip(s + pos, last - pos, _step);
+            cps.push_back(cp + i);
+            cus.push_back(pos);
+        }
+
+        return n;
+    }
+
+    /**
+     * Replaces the block starts [@a first, @a last) with @a starts, shifts the following
+     * ones by @a delta (modulo arithmetic).
+     */
+    static void splice (std::vector<std::size_t> & v, std::size_t first, std::size_t last
+        , std::vector<std::size_t> const & starts, std::size_t delta)
+    {
+        if (starts.size() == last - first) {
+            std::copy(starts.begin(), starts.end(), v.begin() + first);
+        } else {
+            v.erase(v.begin() + first, v.begin() + last);
+            v.insert(v.begin() + first, starts.begin(), starts.end());
+        }
+
+        for (auto i = first + starts.size(); i < v.size(); i++)
+            v[i] += delta;
+    }
+
+public:
+    /**
+     * Constructs the index of empty text with block size @a step code points.
+     */
+    explicit utf8_index (std::size_t step = 64)
+        : _step(step > 0 ? step : 1)
+    {}
+
+    /**
+     * Constructs the index of the text [@a s, @a s + @a n).
+     */
+    utf8_index (char const * s, std::size_t n, std::size_t step = 64)
+        : utf8_index(step)
+    {
+        assign(s, n);
+    }
+
+    /**
+     * Indexes the text [@a s, @a s + @a n) from scratch.
+     */
+    void assign (char const * s, std::size_t n)
+    {
+        _cp.clear();
+        _cu.clear();
+        _cp_count = sample(s, 0, n, 0, _cp, _cu);
+        _cu_count = n;
+    }
+
+    std::size_t step () const noexcept
+    {
+        return _step;
+    }
+
+    /**
+     * Number of code points in the indexed text.
+     */
+    std::size_t code_points () const noexcept
+    {
+        return _cp_count;
+    }
+
+    /**
+     * Number of code units (octets) in the indexed text.
+     */
+    std::size_t code_units () const noexcept
+    {
+        return _cu_count;
+    }
+
+    /**
+     * Position in code units of the code point @a cp (@c code_units() if @a cp is not less
+     * than @c code_points()).
+     */
+    std::size_t code_unit_at (char const * s, std::size_t cp) const noexcept
+    {
+        if (cp >= _cp_count)
+            return _cu_count;
+
+        auto i = block_by_code_point(cp);
+        return _cu[i] + details::utf8_skip(s + _cu[i], _cu_count - _cu[i], cp - _cp[i]);
+    }
+
+    /**
+     * Number of code points that start before the position @a cu in code units (position
+     * in code points if @a cu is the start of the code point).
+     */
+    std::size_t code_point_at (char const * s, std::size_t cu) const noexcept
+    {
+        if (cu >= _cu_count)
+            return _cp_count;
+
+        auto i = block_by_code_unit(cu);
+        return _cp[i] + utf32_length_from_utf8(s + _cu[i], cu - _cu[i]);
+    }
+
+    /**
+     * Iterator pointing to the code point @a cp of the text @a s (advance from the beginning
+     * without the scan of the preceding text).
+     */
+    template <typename SequencePolicy = except_broken_sequence>
+    utf8_iterator<char const *, SequencePolicy> iterator_at (char const * s, std::size_t cp) const
+    {
+        return utf8_iterator<char const *, SequencePolicy>::begin(s + code_unit_at(s, cp)
+            , s + _cu_count);
+    }
+
+    /**
+     * Updates the index after the edit of the text: @a removed code units starting at
+     * position @a cu are replaced with @a inserted ones. @a s is the text after the edit.
+     *
+     * Only the blocks touched by the edit are sampled again, the following ones are shifted.
+     */
+    void replace (char const * s, std::size_t cu, std::size_t removed, std::size_t inserted)
+    {
+        cu = (std::min)(cu, _cu_count);
+        removed = (std::min)(removed, _cu_count - cu);
+
+        auto first_block = block_by_code_unit(cu);
+        auto last_block = first_block;
+
+        // Last block containing the removed code units
+        while (last_block + 1 < _cu.size() && _cu[last_block + 1] < cu + removed)
+            last_block++;
+
+        auto next_block = last_block + 1;
+        auto old_last = next_block < _cu.size() ? _cu[next_block] : _cu_count;
+        auto old_cp = (next_block < _cp.size() ? _cp[next_block] : _cp_count) - _cp[first_block];
+        auto new_last = old_last - removed + inserted;
+
+        std::vector<std::size_t> cps;
+        std::vector<std::size_t> cus;
+        auto new_cp = sample(s, _cu[first_block], new_last, _cp[first_block], cps, cus);
+
+        // Empty block is not kept (except the first one)
+        if (new_cp == 0 && first_block > 0) {
+            cps.clear();
+            cus.clear();
+        }
+
+        splice(_cp, first_block, next_block, cps, new_cp - old_cp);
+        splice(_cu, first_block, next_block, cus, inserted - removed);
+
+        _cp_count = _cp_count + new_cp - old_cp;
+        _cu_count = _cu_count + inserted - removed;
+    }
+};
+
+}} // namespace pfs::unicode
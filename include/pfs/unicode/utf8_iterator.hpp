@@ -8,10 +8,18 @@
 //      2020.11.01 Refactored u8_input_iterator
 //      2023.04.13 Added `advance` method.
 //      2023.05.12 Renamed `utf8_input_iterator` into `utf8_iterator`.
+//      2026.10.19 ASCII fast path for advancing and counting.
+//                 Added sequence policy parameter and `utf8_unchecked_iterator` for
+//                 sequences validated with `utf8_validate`.
+//                 Added `replace_broken_sequence` and `stop_broken_sequence` policies.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "../i18n.hpp"
 #include "utf_iterator.hpp"
+#include "utf8_validate.hpp"
+#include <algorithm>
+#include <limits>
+#include <type_traits>
 
 /* UTF-8
  *
@@ -38,9 +46,15 @@ namespace unicode {
 //
 //////////////////////////////////////////////////////////////////////////////////////////
 
-template <typename OctetFwdIt>
+/**
+ * @tparam SequencePolicy Handling of the broken sequences: @c except_broken_sequence throws
+ *         error, @c replace_broken_sequence decodes it as U+FFFD and continues,
+ *         @c stop_broken_sequence decodes it as U+FFFD and moves to the end (see broken()),
+ *         @c unchecked_sequence assumes the sequence is valid.
+ */
+template <typename OctetFwdIt, typename SequencePolicy = except_broken_sequence>
 class utf8_iterator
-    : public details::utf_iterator<utf8_iterator<OctetFwdIt>, OctetFwdIt>
+    : public details::utf_iterator<utf8_iterator<OctetFwdIt, SequencePolicy>, OctetFwdIt>
 {
     using base_class = details::utf_iterator<utf8_iterator, OctetFwdIt>;
 
@@ -49,71 +63,139 @@ class utf8_iterator
 public:
     using difference_type = typename base_class::difference_type;
 
-protected:
-    char_t advance (OctetFwdIt & pos, OctetFwdIt last, difference_type n) const
+private:
+    /**
+     * Skips at most @a n ASCII characters starting from @a pos.
+     */
+    static difference_type ascii_run (OctetFwdIt & pos, OctetFwdIt last, difference_type n, std::true_type)
+    {
+        auto avail = std::distance(pos, last);
+        auto k = static_cast<difference_type>(details::ascii_prefix(details::octet_pointer(pos)
+            , static_cast<std::size_t>((std::min)(n, avail))));
+        std::advance(pos, k);
+        return k;
+    }
+
+    static difference_type ascii_run (OctetFwdIt & pos, OctetFwdIt last, difference_type n, std::false_type)
     {
+        difference_type k = 0;
+
+        for (; k < n && pos != last && code_unit_cast<std::uint8_t>(*pos) < 0x80; ++pos)
+            k++;
+
+        return k;
+    }
+
+    static difference_type ascii_run (OctetFwdIt & pos, OctetFwdIt last, difference_type n)
+    {
+        return ascii_run(pos, last, n, details::is_contiguous_octet_iterator<OctetFwdIt>{});
+    }
+
+    // Unexpected end of the checked sequence is an error anyway
+    using broken_policy = typename std::conditional<std::is_same<SequencePolicy, unchecked_sequence>::value
+        , except_broken_sequence, SequencePolicy>::type;
+
+    char_t::value_type on_broken_sequence (OctetFwdIt & pos, OctetFwdIt last) const
+    {
+        return this->broken_sequence(pos, last, broken_policy{});
+    }
+
+    char_t::value_type decode (OctetFwdIt & pos, OctetFwdIt last) const
+    {
+        if (pos == last)
+            return on_broken_sequence(pos, last);
+
+        std::uint8_t b = code_unit_cast<std::uint8_t>(*pos);
+        ++pos;
+
+        if (b < 128)
+            return b;
+
         char_t::value_type result;
+        int nunits = 0;
 
-        while (n-- > 0) {
+        if (std::is_same<SequencePolicy, unchecked_sequence>::value) {
+            nunits = b >= 0xF0 ? 4 : b >= 0xE0 ? 3 : 2;
+            result = b & (0x7F >> nunits);
+
+            // Sequence is checked, so the end can not be reached here
+            while (--nunits) {
+                result = (result << 6) | (code_unit_cast<std::uint8_t>(*pos) & 0x3F);
+                ++pos;
+            }
+
+            return result;
+        }
+
+        if ((b & 0xE0) == 0xC0) {
+            result = b & 0x1F;
+            nunits = 2;
+        } else if ((b & 0xF0) == 0xE0) {
+            result = b & 0x0F;
+            nunits = 3;
+        } else if ((b & 0xF8) == 0xF0) {
+            result = b & 0x07;
+            nunits = 4;
+        } else if ((b & 0xFC) == 0xF8) {
+            result = b & 0x03;
+            nunits = 5;
+        } else if ((b & 0xFE) == 0xFC) {
+            result = b & 0x01;
+            nunits = 6;
+        } else {
+            return on_broken_sequence(pos, last);
+        }
+
+        while (--nunits) {
             if (pos == last)
-                throw error {tr::_("broken sequence")};
+                return on_broken_sequence(pos, last);
 
-            std::uint8_t b = code_unit_cast<std::uint8_t>(*pos);
-            ++pos;
-            int nunits = 0;
+            b = code_unit_cast<std::uint8_t>(*pos);
 
-            if (b < 128) {
-                result = b;
-                nunits = 1;
-            } else if ((b & 0xE0) == 0xC0) {
-                result = b & 0x1F;
-                nunits = 2;
-            } else if ((b & 0xF0) == 0xE0) {
-                result = b & 0x0F;
-                nunits = 3;
-            } else if ((b & 0xF8) == 0xF0) {
-                result = b & 0x07;
-                nunits = 4;
-            } else if ((b & 0xFC) == 0xF8) {
-                result = b & 0x03;
-                nunits = 5;
-            } else if ((b & 0xFE) == 0xFC) {
-                result = b & 0x01;
-                nunits = 6;
-            } else {
-                throw error {tr::_("broken sequence")};
-            }
+            // Not a continuation octet is left to start the next sequence
+            if ((b & 0xC0) != 0x80)
+                return on_broken_sequence(pos, last);
 
-            while (--nunits) {
-                if (pos == last)
-                    throw error {tr::_("broken sequence")};
+            result = (result << 6) | (b & 0x3F);
+            ++pos;
+        }
 
-                b = code_unit_cast<std::uint8_t>(*pos);
-                ++pos;
+        return result;
+    }
 
-                if ((b & 0xC0) == 0x80) {
-                    result = (result << 6) | (b & 0x3F);
-                } else {
-                    throw error {tr::_("broken sequence")};
-                }
+protected:
+    char_t advance (OctetFwdIt & pos, OctetFwdIt last, difference_type n) const
+    {
+        // Only the last character is returned, the preceding ones are checked only
+        while (n > 1) {
+            if (pos != last && code_unit_cast<std::uint8_t>(*pos) < 128) {
+                n -= ascii_run(pos, last, n - 1);
+            } else {
+                decode(pos, last);
+                n--;
             }
         }
 
-        return char_t{result};
+        return n > 0 ? char_t{decode(pos, last)} : char_t{};
     }
 
     /**
      * Advance iterator @a pos by @a n code points.
      */
-    void advance (OctetFwdIt & pos, difference_type n) const
+    void skip (OctetFwdIt & pos, OctetFwdIt last, difference_type n) const
     {
-        while (n--) {
+        while (n > 0) {
             std::uint8_t b = code_unit_cast<std::uint8_t>(*pos);
-            ++pos;
 
             if (b < 128) {
-                ;
-            } else if ((b & 0xE0) == 0xC0) {
+                n -= ascii_run(pos, last, n);
+                continue;
+            }
+
+            ++pos;
+            n--;
+
+            if ((b & 0xE0) == 0xC0) {
                 ++pos;
             } else if ((b & 0xF0) == 0xE0) {
                 pos += 2;
@@ -124,7 +206,10 @@ protected:
             } else if ((b & 0xFE) == 0xFC) {
                 pos += 5;
             } else {
-                throw error {tr::_("broken sequence")};
+                on_broken_sequence(pos, last);
+
+                if (pos == last)
+                    return;
             }
         }
     }
@@ -144,11 +229,17 @@ protected:
 
         while (pos != last) {
             std::uint8_t b = code_unit_cast<std::uint8_t>(*pos);
-            ++pos;
 
             if (b < 128) {
-                cu_count++;
-            } else if ((b & 0xE0) == 0xC0) {
+                auto k = ascii_run(pos, last, (std::numeric_limits<difference_type>::max)());
+                cp_count += k;
+                cu_count += k;
+                continue;
+            }
+
+            ++pos;
+
+            if ((b & 0xE0) == 0xC0) {
                 cu_count += 2;
                 ++pos;
             } else if ((b & 0xF0) == 0xE0) {
@@ -164,7 +255,8 @@ protected:
                 cu_count += 6;
                 pos += 5;
             } else {
-                throw error {tr::_("broken sequence")};
+                cu_count++;
+                on_broken_sequence(pos, last);
             }
 
             cp_count++;
@@ -177,6 +269,13 @@ public:
     using base_class::base_class;
 };
 
+/**
+ * Iterator over the sequence that is known to be valid (i.e. checked by utf8_validate()):
+ * decoding skips the checks of continuation bytes.
+ */
+template <typename OctetFwdIt>
+using utf8_unchecked_iterator = utf8_iterator<OctetFwdIt, unchecked_sequence>;
+
 template <typename OctetOutputIt>
 struct utf8_output_iterator_proxy
 {
@@ -0,0 +1,466 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "pfs/bit.hpp"
+#include "pfs/cpu_features.hpp"
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Useful links:
+// [Validating UTF-8 In Less Than One Instruction Per Byte](https://arxiv.org/abs/2010.03090)
+// [RFC 3629](https://www.rfc-editor.org/rfc/rfc3629)
+
+namespace pfs {
+namespace unicode {
+
+namespace details {
+
+template <typename It>
+struct is_contiguous_octet_iterator : std::integral_constant<bool
+    , std::is_same<It, char *>::value
+    || std::is_same<It, char const *>::value
+    || std::is_same<It, unsigned char *>::value
+    || std::is_same<It, unsigned char const *>::value
+    || std::is_same<It, std::string::iterator>::value
+    || std::is_same<It, std::string::const_iterator>::value
+    || std::is_same<It, std::vector<char>::iterator>::value
+    || std::is_same<It, std::vector<char>::const_iterator>::value
+    || std::is_same<It, std::vector<unsigned char>::iterator>::value
+    || std::is_same<It, std::vector<unsigned char>::const_iterator>::value>
+{};
+
+/**
+ * Pointer to the octet referenced by the contiguous iterator @a it (must be dereferenceable).
+ */
+template <typename It>
+inline std::uint8_t const * octet_pointer (It it) noexcept
+{
+    return reinterpret_cast<std::uint8_t const *>(& *it);
+}
+
+inline std::size_t ascii_prefix_scalar (std::uint8_t const * p, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        std::uint64_t x;
+        std::memcpy(& x, p + i, 8);
+        x &= 0x8080808080808080ULL;
+
+        if (x != 0) {
+            for (; p[i] < 0x80; i++)
+                ;
+
+            return i;
+        }
+    }
+
+    for (; i < n && p[i] < 0x80; i++)
+        ;
+
+    return i;
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+PFS__TARGET("sse2")
+inline std::size_t ascii_prefix_sse2 (std::uint8_t const * p, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+            _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i))));
+
+        if (mask != 0)
+            return i + static_cast<std::size_t>(countr_zero(mask));
+    }
+
+    return i + ascii_prefix_scalar(p + i, n - i);
+}
+
+PFS__TARGET("avx2")
+inline std::size_t ascii_prefix_avx2 (std::uint8_t const * p, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i))));
+
+        if (mask != 0)
+            return i + static_cast<std::size_t>(countr_zero(mask));
+    }
+
+    return i + ascii_prefix_sse2(p + i, n - i);
+}
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+/**
+ * Number of leading ASCII characters in the buffer.
+ */
+inline std::size_t ascii_prefix (std::uint8_t const * p, std::size_t n) noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (n >= 32 && cpu_features().avx2)
+        return ascii_prefix_avx2(p, n);
+
+    if (n >= 16 && cpu_features().sse2)
+        return ascii_prefix_sse2(p, n);
+#endif
+
+    return ascii_prefix_scalar(p, n);
+}
+
+/**
+ * Scalar validation according to RFC 3629 (no overlong forms, no surrogates, code points up
+ * to U+10FFFF).
+ *
+ * @return Length of the valid prefix in code units, i.e. position of the first invalid
+ *         (or incomplete) sequence or the length of the whole range.
+ */
+template <typename OctetFwdIt>
+std::size_t utf8_valid_prefix_scalar (OctetFwdIt first, OctetFwdIt last)
+{
+    std::size_t pos = 0;
+
+    while (first != last) {
+        auto b = static_cast<std::uint8_t>(*first);
+
+        if (b < 0x80) {
+            ++first;
+            ++pos;
+            continue;
+        }
+
+        int n = 0;
+
+        // Valid range of the second byte, the rest continuation bytes are in [0x80, 0xBF]
+        std::uint8_t lo = 0x80;
+        std::uint8_t hi = 0xBF;
+
+        if (b >= 0xC2 && b <= 0xDF) {
+            n = 1;
+        } else if (b == 0xE0) {
+            n = 2;
+            lo = 0xA0;
+        } else if (b == 0xED) {
+            n = 2;
+            hi = 0x9F;
+        } else if (b >= 0xE1 && b <= 0xEF) {
+            n = 2;
+        } else if (b == 0xF0) {
+            n = 3;
+            lo = 0x90;
+        } else if (b >= 0xF1 && b <= 0xF3) {
+            n = 3;
+        } else if (b == 0xF4) {
+            n = 3;
+            hi = 0x8F;
+        } else {
+            return pos;
+        }
+
+        auto p = first;
+        ++p;
+
+        for (int i = 0; i < n; i++, ++p) {
+            if (p == last)
+                return pos;
+
+            auto c = static_cast<std::uint8_t>(*p);
+
+            if (c < lo || c > hi)
+                return pos;
+
+            lo = 0x80;
+            hi = 0xBF;
+        }
+
+        first = p;
+        pos += static_cast<std::size_t>(n) + 1;
+    }
+
+    return pos;
+}
+
+/**
+ * Resumes validation with the scalar algorithm from the code point containing the byte
+ * before @a i (all sequences started before it are valid).
+ */
+inline std::size_t utf8_valid_prefix_resume (std::uint8_t const * p, std::size_t n, std::size_t i) noexcept
+{
+    auto start = i >= 3 ? i - 3 : std::size_t{0};
+
+    if (i > 0) {
+        while (start < i && (p[start] & 0xC0) == 0x80)
+            start++;
+    }
+
+    return start + utf8_valid_prefix_scalar(p + start, p + n);
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+
+// Lookup tables of the Keiser-Lemire algorithm: each table maps the nibble to the set of
+// errors that are possible with it, error is detected if the intersection of the sets for
+// the high and low nibbles of the previous byte and the high nibble of the current byte
+// is not empty.
+enum : std::uint8_t {
+      utf8_too_short  = 1 << 0  // 11______ 0_______ or 11______ 11______
+    , utf8_too_long   = 1 << 1  // 0_______ 10______
+    , utf8_overlong_3 = 1 << 2  // 11100000 100_____
+    , utf8_too_large  = 1 << 3  // 11110100 1001____ etc.
+    , utf8_surrogate  = 1 << 4  // 11101101 101_____
+    , utf8_overlong_2 = 1 << 5  // 1100000_ 10______
+    , utf8_too_large_1000 = 1 << 6  // 11110101 1000____ etc.
+    , utf8_overlong_4 = 1 << 6  // 11110000 1000____
+    , utf8_two_conts  = 1 << 7  // 10______ 10______
+    , utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts
+};
+
+struct utf8_lookup_tables
+{
+    std::uint8_t byte_1_high[16];
+    std::uint8_t byte_1_low[16];
+    std::uint8_t byte_2_high[16];
+
+    // Maximum values of the last three bytes of the block that do not start a sequence
+    // continued in the next block
+    std::uint8_t incomplete_max[16];
+};
+
+inline utf8_lookup_tables const & utf8_lookup () noexcept
+{
+    static utf8_lookup_tables const tables = {
+        {
+              // 0_______ ________ (ASCII in the first byte)
+              utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long
+            , utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long
+              // 10______ ________ (continuation in the first byte)
+            , utf8_two_conts, utf8_two_conts, utf8_two_conts, utf8_two_conts
+              // 1100____ ________ (two-byte lead)
+            , utf8_too_short | utf8_overlong_2
+              // 1101____ ________ (two-byte lead)
+            , utf8_too_short
+              // 1110____ ________ (three-byte lead)
+            , utf8_too_short | utf8_overlong_3 | utf8_surrogate
+              // 1111____ ________ (four-byte lead)
+            , utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4
+        }
+        , {
+              // ____0000 ________
+              utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4
+              // ____0001 ________
+            , utf8_carry | utf8_overlong_2
+              // ____001_ ________
+            , utf8_carry
+            , utf8_carry
+              // ____0100 ________
+            , utf8_carry | utf8_too_large
+              // ____0101 ________ - ____1100 ________
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+              // ____1101 ________
+            , utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate
+              // ____111_ ________
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+            , utf8_carry | utf8_too_large | utf8_too_large_1000
+        }
+        , {
+              // ________ 0_______ (ASCII in the second byte)
+              utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short
+            , utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short
+              // ________ 1000____
+            , utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3
+                | utf8_too_large_1000 | utf8_overlong_4
+              // ________ 1001____
+            , utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large
+              // ________ 101_____
+            , utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large
+            , utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large
+              // ________ 11______
+            , utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short
+        }
+        , {
+              0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+            , 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+        }
+    };
+
+    return tables;
+}
+
+// Checks blocks of WIDTH bytes, the block is checked against the last bytes of the previous
+// one, so sequences spanning blocks are validated too. Blocks of ASCII characters are only
+// checked for the incomplete sequence at the end of the previous block. The tail shorter than
+// the block (and the sequence started in the last block) is validated by the scalar algorithm.
+#define PFS__UTF8_VALIDATE_KERNEL(NAME, TARGET, WIDTH, VEC, LOAD, TABLE, ZERO, MOVEMASK   \
+        , PREV, SHUFFLE, AND, OR, XOR, SUBS, SRLI16, SET1, CMPEQ, ALL_ONES)                \
+PFS__TARGET(TARGET)                                                                        \
+inline std::size_t NAME (std::uint8_t const * p, std::size_t n) noexcept                   \
+{                                                                                          \
+    auto const & tables = utf8_lookup();                                                   \
+    auto const byte_1_high = TABLE(tables.byte_1_high);                                    \
+    auto const byte_1_low = TABLE(tables.byte_1_low);                                      \
+    auto const byte_2_high = TABLE(tables.byte_2_high);                                    \
+    auto const low_nibble = SET1(0x0F);                                                    \
+    auto const bit7 = SET1(static_cast<char>(0x80));                                       \
+    auto const third_byte_min = SET1(static_cast<char>(0xE0 - 0x80));                      \
+    auto const fourth_byte_min = SET1(static_cast<char>(0xF0 - 0x80));                     \
+    VEC incomplete_max;                                                                    \
+    {                                                                                      \
+        alignas(WIDTH) std::uint8_t buf[WIDTH];                                            \
+        std::memset(buf, 0xFF, WIDTH);                                                     \
+        std::memcpy(buf + WIDTH - 16, tables.incomplete_max, 16);                          \
+        incomplete_max = LOAD(buf);                                                        \
+    }                                                                                      \
+                                                                                           \
+    auto prev_input = ZERO();                                                              \
+    auto prev_incomplete = ZERO();                                                         \
+    std::size_t i = 0;                                                                     \
+                                                                                           \
+    for (; i + WIDTH <= n; i += WIDTH) {                                                   \
+        auto input = LOAD(p + i);                                                          \
+        VEC error;                                                                         \
+                                                                                           \
+        if (MOVEMASK(input) == 0) {                                                        \
+            error = prev_incomplete;                                                       \
+        } else {                                                                           \
+            auto prev1 = PREV(input, prev_input, 1);                                       \
+            auto prev2 = PREV(input, prev_input, 2);                                       \
+            auto prev3 = PREV(input, prev_input, 3);                                       \
+                                                                                           \
+            auto sc = AND(AND(                                                             \
+                  SHUFFLE(byte_1_high, AND(SRLI16(prev1, 4), low_nibble))                  \
+                , SHUFFLE(byte_1_low, AND(prev1, low_nibble)))                             \
+                , SHUFFLE(byte_2_high, AND(SRLI16(input, 4), low_nibble)));                \
+                                                                                           \
+            auto must23 = OR(SUBS(prev2, third_byte_min), SUBS(prev3, fourth_byte_min));   \
+            error = XOR(AND(must23, bit7), sc);                                            \
+            prev_incomplete = SUBS(input, incomplete_max);                                 \
+        }                                                                                  \
+                                                                                           \
+        if (MOVEMASK(CMPEQ(error, ZERO())) != ALL_ONES)                                    \
+            return utf8_valid_prefix_resume(p, n, i);                                      \
+                                                                                           \
+        prev_input = input;                                                                \
+    }                                                                                      \
+                                                                                           \
+    return utf8_valid_prefix_resume(p, n, i);                                              \
+}
+
+#define PFS__UTF8_LOAD128(p) _mm_loadu_si128(reinterpret_cast<__m128i const *>(p))
+#define PFS__UTF8_LOAD256(p) _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p))
+#define PFS__UTF8_TABLE128(t) PFS__UTF8_LOAD128(t)
+#define PFS__UTF8_TABLE256(t) _mm256_broadcastsi128_si256(PFS__UTF8_LOAD128(t))
+#define PFS__UTF8_PREV128(input, prev, N) _mm_alignr_epi8(input, prev, 16 - N)
+#define PFS__UTF8_PREV256(input, prev, N) \
+    _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N)
+#define PFS__UTF8_MOVEMASK128(x) static_cast<std::uint32_t>(_mm_movemask_epi8(x))
+#define PFS__UTF8_MOVEMASK256(x) static_cast<std::uint32_t>(_mm256_movemask_epi8(x))
+
+PFS__UTF8_VALIDATE_KERNEL(utf8_valid_prefix_ssse3, "ssse3", 16, __m128i, PFS__UTF8_LOAD128
+    , PFS__UTF8_TABLE128, _mm_setzero_si128, PFS__UTF8_MOVEMASK128, PFS__UTF8_PREV128
+    , _mm_shuffle_epi8, _mm_and_si128, _mm_or_si128, _mm_xor_si128, _mm_subs_epu8
+    , _mm_srli_epi16, _mm_set1_epi8, _mm_cmpeq_epi8, 0xFFFFu)
+
+PFS__UTF8_VALIDATE_KERNEL(utf8_valid_prefix_avx2, "avx2", 32, __m256i, PFS__UTF8_LOAD256
+    , PFS__UTF8_TABLE256, _mm256_setzero_si256, PFS__UTF8_MOVEMASK256, PFS__UTF8_PREV256
+    , _mm256_shuffle_epi8, _mm256_and_si256, _mm256_or_si256, _mm256_xor_si256, _mm256_subs_epu8
+    , _mm256_srli_epi16, _mm256_set1_epi8, _mm256_cmpeq_epi8, 0xFFFFFFFFu)
+
+#undef PFS__UTF8_LOAD128
+#undef PFS__UTF8_LOAD256
+#undef PFS__UTF8_TABLE128
+#undef PFS__UTF8_TABLE256
+#undef PFS__UTF8_PREV128
+#undef PFS__UTF8_PREV256
+#undef PFS__UTF8_MOVEMASK128
+#undef PFS__UTF8_MOVEMASK256
+#undef PFS__UTF8_VALIDATE_KERNEL
+
+#endif // PFS__X86_INTRINSICS_ENABLED
+
+inline std::size_t utf8_valid_prefix (std::uint8_t const * p, std::size_t n) noexcept
+{
+#if PFS__X86_INTRINSICS_ENABLED
+    if (cpu_features().avx2)
+        return utf8_valid_prefix_avx2(p, n);
+
+    if (cpu_features().ssse3)
+        return utf8_valid_prefix_ssse3(p, n);
+#endif
+
+    return utf8_valid_prefix_scalar(p, p + n);
+}
+
+template <typename OctetFwdIt>
+bool utf8_validate (OctetFwdIt first, OctetFwdIt last, std::size_t & pos, std::true_type)
+{
+    if (first == last)
+        return true;
+
+    auto n = static_cast<std::size_t>(std::distance(first, last));
+    pos = utf8_valid_prefix(octet_pointer(first), n);
+    return pos == n;
+}
+
+template <typename OctetFwdIt>
+bool utf8_validate (OctetFwdIt first, OctetFwdIt last, std::size_t & pos, std::false_type)
+{
+    // Advance by the valid prefix to detect the end of the range without computing its length
+    pos = utf8_valid_prefix_scalar(first, last);
+    std::advance(first, pos);
+    return first == last;
+}
+
+} // namespace details
+
+/**
+ * Checks that [@a first, @a last) is a well-formed UTF-8 sequence according to RFC 3629:
+ * no overlong forms, no surrogates and no code points above U+10FFFF (so five- and six-byte
+ * sequences accepted by utf8_iterator are rejected).
+ *
+ * Contiguous sequences are checked with SIMD (SSSE3/AVX2) if available.
+ *
+ * @param error_pos Receives the position (in code units) of the first invalid or incomplete
+ *        sequence on failure (optional).
+ */
+template <typename OctetFwdIt>
+bool utf8_validate (OctetFwdIt first, OctetFwdIt last, std::size_t * error_pos = nullptr)
+{
+    std::size_t pos = 0;
+
+    if (details::utf8_validate(first, last, pos, details::is_contiguous_octet_iterator<OctetFwdIt>{}))
+        return true;
+
+    if (error_pos != nullptr)
+        *error_pos = pos;
+
+    return false;
+}
+
+inline bool utf8_validate (std::string const & s, std::size_t * error_pos = nullptr)
+{
+    return utf8_validate(s.begin(), s.end(), error_pos);
+}
+
+}} // namespace pfs::unicode
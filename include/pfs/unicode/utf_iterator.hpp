@@ -7,8 +7,11 @@
 //      2020.11.01 Initial version
 //      2023.05.12 Renamed `utf_input_iterator` into `utf_iterator` and changed
 //                 category from `input` to `forward` iterator.
+//      2026.10.19 Added `broken` method.
+//                 Increment reuses the character decoded by dereference.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include "../i18n.hpp"
 #include "pfs/error.hpp"
 #include "pfs/iterator.hpp"
 #include "char.hpp"
@@ -46,6 +49,9 @@ protected:
     XtetFwdIt _last;
     char_t    _value;
 
+    // Set by the non-throwing sequence policies
+    mutable bool _broken {false};
+
 protected:
     utf_iterator (XtetFwdIt first, XtetFwdIt last)
         : _p(first)
@@ -104,6 +110,12 @@ public:
     // Input iterator requirements
     void increment (difference_type n)
     {
+        // Character is decoded already by dereference
+        if (n == 1 && _next != _p) {
+            _p = _next;
+            return;
+        }
+
         static_cast<Derived *>(this)->advance(this->_p, this->_last, n);
         _next = _p;
     }
@@ -118,6 +130,15 @@ public:
         return _p;
     }
 
+    /**
+     * Returns @c true if the broken sequence was met and replaced by U+FFFD (see
+     * @c replace_broken_sequence and @c stop_broken_sequence policies).
+     */
+    bool broken () const noexcept
+    {
+        return _broken;
+    }
+
 public:
     /**
      * Returns distance in a code points (first member in the pair) and in a
@@ -138,8 +159,30 @@ public:
     static void advance_unsafe (Derived & pos, difference_type n)
     {
         XtetFwdIt p = pos._p;
-        pos.advance(p, n);
+        pos.skip(p, pos._last, n);
+
+        auto broken = pos._broken;
         pos = begin(p, pos._last);
+        pos._broken = broken;
+    }
+
+protected:
+    char_t::value_type broken_sequence (XtetFwdIt &, XtetFwdIt, except_broken_sequence) const
+    {
+        throw error {tr::_("broken sequence")};
+    }
+
+    char_t::value_type broken_sequence (XtetFwdIt &, XtetFwdIt, replace_broken_sequence) const noexcept
+    {
+        _broken = true;
+        return char_t::replacement_char;
+    }
+
+    char_t::value_type broken_sequence (XtetFwdIt & pos, XtetFwdIt last, stop_broken_sequence) const noexcept
+    {
+        _broken = true;
+        pos = last;
+        return char_t::replacement_char;
     }
 };
 
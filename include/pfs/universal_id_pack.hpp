@@ -8,6 +8,7 @@
 //      2025.01.24 Removed `binary_istream_nt`.
 //      2025.08.11 pack/upack() functions are deprecated.
 //      2025.08.12 Removed deprecated functions.
+//      2026.10.19 Support for streamed binary_istream.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "c++support.hpp"
@@ -28,8 +29,8 @@ inline void pack (binary_ostream<Endianess, Archive> & out, universal_id const &
         out << low(uuid) << high(uuid);
 }
 
-template <endian Endianess>
-inline void unpack (binary_istream<Endianess> & in, universal_id & uuid)
+template <endian Endianess, typename Source>
+inline void unpack (binary_istream<Endianess, Source> & in, universal_id & uuid)
 {
     std::uint64_t h {0}, l {0};
 
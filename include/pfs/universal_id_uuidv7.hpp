@@ -5,11 +5,13 @@
 //
 // Changelog:
 //      2024.12.23 Initial version.
+//      2026.10.19 String conversion uses vectorized hex encoding.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "namespace.hpp"
 #include "assert.hpp"
 #include "fmt.hpp"
+#include "hex.hpp"
 #include "optional.hpp"
 #include <array>
 #include <chrono>
@@ -21,8 +23,47 @@ PFS__NAMESPACE_BEGIN
 
 namespace details {
 #include "3rdparty/uuidv7/uuidv7.h"
+
+/**
+ * Encodes UUID in the 8-4-4-4-12 hexadecimal string representation (36 characters,
+ * no terminating null character).
+ */
+inline void uuid_to_chars (std::uint8_t const * u, char * out) noexcept
+{
+    char hex[32];
+    ::pfs::to_hex(u, 16, hex);
+
+    std::memcpy(out, hex, 8);
+    out[8] = '-';
+    std::memcpy(out + 9, hex + 8, 4);
+    out[13] = '-';
+    std::memcpy(out + 14, hex + 12, 4);
+    out[18] = '-';
+    std::memcpy(out + 19, hex + 16, 4);
+    out[23] = '-';
+    std::memcpy(out + 24, hex + 20, 12);
+}
+
+/**
+ * Decodes the 8-4-4-4-12 hexadecimal string representation of UUID (36 characters).
+ */
+inline bool uuid_from_chars (char const * s, std::uint8_t * u) noexcept
+{
+    if (s[8] != '-' || s[13] != '-' || s[18] != '-' || s[23] != '-')
+        return false;
+
+    char hex[32];
+    std::memcpy(hex, s, 8);
+    std::memcpy(hex + 8, s + 9, 4);
+    std::memcpy(hex + 12, s + 14, 4);
+    std::memcpy(hex + 16, s + 19, 4);
+    std::memcpy(hex + 20, s + 24, 12);
+
+    return ::pfs::from_hex(hex, 32, u) == 32;
 }
 
+} // namespace details
+
 // References:
 // 1. https://www.rfc-editor.org/rfc/rfc9562
 // 2. https://github.com/LiosK/uuidv7-h
@@ -46,9 +87,9 @@ public:
 public:
     std::string to_string () const
     {
-        char out[37];
-        details::uuidv7_to_string(_u.data(), out);
-        return std::string(out, out + 36);
+        std::string result(36, '\0');
+        details::uuid_to_chars(_u.data(), & result[0]);
+        return result;
     }
 
     std::array<std::uint8_t, 16> to_array () const
@@ -229,21 +270,13 @@ inline pfs::optional<universal_id> parse_universal_id (char const * s, std::size
         if (n != 38)
             return pfs::nullopt;
 
-        std::array<char, 37> tmp;
-        std::copy(s + 1, s + n - 1, tmp.begin());
-        tmp[36] = '\x0';
-
-        auto rc = details::uuidv7_from_string(tmp.data(), u.data());
-
-        if (rc != 0)
+        if (!details::uuid_from_chars(s + 1, u.data()))
             return pfs::nullopt;
     } else {
         if (n != 36)
             return pfs::nullopt;
 
-        auto rc = details::uuidv7_from_string(s, u.data());
-
-        if (rc != 0)
+        if (!details::uuid_from_chars(s, u.data()))
             return pfs::nullopt;
     }
 
@@ -320,9 +353,7 @@ inline pfs::universal_id operator ""_uuidv7 (char const * str, std::size_t len)
         return pfs::universal_id{};
 
     std::array<std::uint8_t, 16> u;
-    auto rc = PFS__NAMESPACE_NAME::details::uuidv7_from_string(str, u.data());
-
-    if (rc != 0)
+    if (!PFS__NAMESPACE_NAME::details::uuid_from_chars(str, u.data()))
         return pfs::universal_id{};
 
     return pfs::universal_id {std::move(u)};
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+################################################################################
+# Copyright (c) 2026 Vladislav Trifochkin
+#
+# This file is part of `common-lib`.
+#
+# Changelog:
+#      2026.10.19 Initial version.
+################################################################################
+#
+# Generates `include/pfs/unicode/case_tables.hpp` (simple case mappings) from the
+# Unicode Character Database files.
+#
+# Usage: unicode_case_tables.py UnicodeData.txt CaseFolding.txt VERSION > case_tables.hpp
+#
+
+import sys
+
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+
+def load_unicode_data (path):
+    lower, upper = {}, {}
+
+    with open(path) as f:
+        for line in f:
+            fields = line.rstrip('\n').split(';')
+
+            if len(fields) < 14:
+                continue
+
+            cp = int(fields[0], 16)
+
+            # Simple uppercase (12) and lowercase (13) mappings
+            if fields[12]:
+                upper[cp] = int(fields[12], 16)
+
+            if fields[13]:
+                lower[cp] = int(fields[13], 16)
+
+    return lower, upper
+
+
+def load_case_folding (path):
+    fold = {}
+
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+
+            if not line:
+                continue
+
+            code, status, mapping = [x.strip() for x in line.split(';')[:3]]
+
+            # Common and simple foldings give the simple case folding
+            if status in ('C', 'S'):
+                fold[int(code, 16)] = int(mapping, 16)
+
+    return fold
+
+
+def main ():
+    lower, upper = load_unicode_data(sys.argv[1])
+    fold = load_case_folding(sys.argv[2])
+    version = sys.argv[3]
+
+    limit = max(max(lower), max(upper), max(fold)) + 1
+    limit = (limit + BLOCK_SIZE - 1) // BLOCK_SIZE * BLOCK_SIZE
+
+    records = [(0, 0, 0)]
+    record_index = {records[0]: 0}
+    blocks = []
+    block_index = {}
+    stage1 = []
+
+    for first in range(0, limit, BLOCK_SIZE):
+        block = []
+
+        for cp in range(first, first + BLOCK_SIZE):
+            rec = (lower.get(cp, cp) - cp, upper.get(cp, cp) - cp, fold.get(cp, cp) - cp)
+
+            if rec not in record_index:
+                record_index[rec] = len(records)
+                records.append(rec)
+
+            block.append(record_index[rec])
+
+        block = tuple(block)
+
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+
+        stage1.append(block_index[block])
+
+    assert len(blocks) <= 256
+    assert len(records) <= 256
+
+    out = sys.stdout
+    out.write('''////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+// Generated by scripts/unicode_case_tables.py from the Unicode Character Database
+// version {version} (UnicodeData.txt, CaseFolding.txt). Do not edit.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstdint>
+
+namespace pfs {{
+namespace unicode {{
+namespace details {{
+
+struct case_record
+{{
+    std::int32_t lower; // Simple lowercase mapping delta
+    std::int32_t upper; // Simple uppercase mapping delta
+    std::int32_t fold;  // Simple case folding delta
+}};
+
+constexpr std::uint32_t case_block_shift = {shift};
+constexpr std::uint32_t case_block_mask = {mask};
+constexpr std::uint32_t case_limit = 0x{limit:X};
+
+inline case_record const & case_record_at (std::uint8_t index) noexcept
+{{
+    static constexpr case_record records[] = {{
+'''.format(version=version, shift=BLOCK_SHIFT, mask=BLOCK_SIZE - 1, limit=limit))
+
+    for i in range(0, len(records), 4):
+        out.write('        ' + ' '.join('{{{}, {}, {}}},'.format(*r) for r in records[i:i + 4]) + '\n')
+
+    out.write('''    }};
+
+    return records[index];
+}}
+
+/**
+ * Index of the block of records for code points [i << case_block_shift, (i + 1) << case_block_shift).
+ */
+inline std::uint8_t case_block_at (std::uint32_t i) noexcept
+{{
+    static constexpr std::uint8_t stage1[{n}] = {{
+'''.format(n=len(stage1)))
+
+    for i in range(0, len(stage1), 16):
+        out.write('        ' + ' '.join('{},'.format(x) for x in stage1[i:i + 16]) + '\n')
+
+    out.write('''    }};
+
+    return stage1[i];
+}}
+
+inline std::uint8_t case_record_index (std::uint8_t block, std::uint32_t offset) noexcept
+{{
+    static constexpr std::uint8_t stage2[{n}][{size}] = {{
+'''.format(n=len(blocks), size=BLOCK_SIZE))
+
+    for block in blocks:
+        out.write('        {\n')
+
+        for i in range(0, BLOCK_SIZE, 32):
+            out.write('              ' + ','.join(str(x) for x in block[i:i + 32]) + ',\n')
+
+        out.write('        },\n')
+
+    out.write('''    };
+
+    return stage2[block][offset];
+}
+
+/**
+ * Case mapping record for the code point @a cp.
+ */
+inline case_record const & case_lookup (std::uint32_t cp) noexcept
+{
+    return case_record_at(cp < case_limit
+        ? case_record_index(case_block_at(cp >> case_block_shift), cp & case_block_mask)
+        : std::uint8_t{0});
+}
+
+}}} // pfs::unicode::details
+''')
+
+
+if __name__ == '__main__':
+    main()
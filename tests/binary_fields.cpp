@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "pfs/binary_fields.hpp"
+#include "pfs/binary_istream.hpp"
+#include "pfs/binary_ostream.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace test {
+
+enum class kind: std::uint8_t { a = 1, b = 2 };
+
+// No padding: may be copied as is
+struct header
+{
+    std::uint16_t type;
+    std::uint16_t flags;
+    std::uint32_t length;
+};
+
+PFS_BINARY_FIELDS(header, type, flags, length)
+
+// Fields listed not in declaration order
+struct reversed_header
+{
+    std::uint16_t type;
+    std::uint16_t flags;
+    std::uint32_t length;
+};
+
+PFS_BINARY_FIELDS(reversed_header, length, flags, type)
+
+// With padding
+struct point
+{
+    kind k;
+    double x;
+    float y;
+    std::int64_t z;
+};
+
+PFS_BINARY_FIELDS(point, k, x, y, z)
+
+// Non-scalar fields
+struct message
+{
+    header h;
+    std::array<char, 4> tag;
+    point p;
+};
+
+PFS_BINARY_FIELDS(message, h, tag, p)
+
+} // namespace test
+
+template <pfs::endian Endianess>
+std::vector<char> pack_manually (test::message const & m)
+{
+    std::vector<char> ar;
+    pfs::binary_ostream<Endianess> out {ar};
+
+    out << m.h.type << m.h.flags << m.h.length << m.tag
+        << m.p.k << m.p.x << m.p.y << m.p.z;
+
+    return ar;
+}
+
+template <pfs::endian Endianess>
+void check_message ()
+{
+    test::message m {{1, 2, 3}, {'a', 'b', 'c', 'd'}, {test::kind::b, 3.14159, 2.71828f, -42}};
+
+    std::vector<char> ar;
+    pfs::binary_ostream<Endianess> out {ar};
+    out << m;
+
+    auto sample = pack_manually<Endianess>(m);
+    CHECK_EQ(ar, sample);
+
+    test::message m1 {};
+    pfs::binary_istream<Endianess> in {ar.data(), ar.size()};
+    in >> m1;
+
+    CHECK(in.is_good());
+    CHECK(in.at_end());
+    CHECK_EQ(m1.h.type, m.h.type);
+    CHECK_EQ(m1.h.flags, m.h.flags);
+    CHECK_EQ(m1.h.length, m.h.length);
+    CHECK_EQ(m1.tag, m.tag);
+    CHECK_EQ(m1.p.k, m.p.k);
+    CHECK_EQ(m1.p.x, m.p.x);
+    CHECK_EQ(m1.p.y, m.p.y);
+    CHECK_EQ(m1.p.z, m.p.z);
+}
+
+template <pfs::endian Endianess>
+void check_reversed_header ()
+{
+    test::reversed_header h {1, 2, 3};
+
+    std::vector<char> ar;
+    pfs::binary_ostream<Endianess> out {ar};
+    out << h;
+
+    std::vector<char> sample;
+    pfs::binary_ostream<Endianess> sample_out {sample};
+    sample_out << h.length << h.flags << h.type;
+
+    CHECK_EQ(ar, sample);
+
+    test::reversed_header h1 {};
+    pfs::binary_istream<Endianess> in {ar.data(), ar.size()};
+    in >> h1;
+
+    CHECK(in.is_good());
+    CHECK_EQ(h1.type, h.type);
+    CHECK_EQ(h1.flags, h.flags);
+    CHECK_EQ(h1.length, h.length);
+}
+
+TEST_CASE("binary fields") {
+    static_assert(pfs::details::binary_fields_memcpy<pfs::endian::native, test::header
+        , std::uint16_t, std::uint16_t, std::uint32_t>::value, "");
+    static_assert(!pfs::details::binary_fields_memcpy<pfs::endian::native, test::point
+        , test::kind, double, float, std::int64_t>::value, "");
+
+    check_message<pfs::endian::big>();
+    check_message<pfs::endian::little>();
+    check_reversed_header<pfs::endian::big>();
+    check_reversed_header<pfs::endian::little>();
+}
+
+TEST_CASE("binary fields out of bound") {
+    std::string source {"\x01\x00\x02\x00\x03\x00", 6};
+    test::header h {0, 0, 0};
+    pfs::binary_istream<pfs::endian::little> in {source.data(), source.size()};
+    in >> h;
+
+    CHECK_FALSE(in.is_good());
+    CHECK_EQ(h.type, 0);
+    CHECK_EQ(h.flags, 0);
+    CHECK_EQ(h.length, 0);
+}
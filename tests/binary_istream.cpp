@@ -5,19 +5,31 @@
 //
 // Changelog:
 //      2025.08.07 Initial version.
+//      2026.10.19 Added streamed source tests.
+//      2026.10.19 Added nested transactions test and frame parsing benchmark.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
 #include "doctest.h"
+#include "nanobench.h"
 #include "pfs/binary_istream.hpp"
+#include "pfs/binary_istream_source.hpp"
+#include "pfs/binary_ostream.hpp"
 #include "pfs/filesystem_pack.hpp"
 #include "pfs/string_view.hpp"
 #include "pfs/time_point_pack.hpp"
 #include "pfs/universal_id_pack.hpp"
 #include <cstring>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#if !_MSC_VER
+#   include <unistd.h>
+#endif
+
 static std::string s_sample_data_le (
     "\x01\x61\xD6\x2A\x00\x80\xFF\xFF"
     "\x00\x00\x00\x80"
@@ -57,19 +69,15 @@ struct A
     char ch;
 };
 
-template <pfs::endian Endianess>
-inline void unpack (pfs::binary_istream<Endianess> & in, A & a)
+template <pfs::endian Endianess, typename Source>
+inline void unpack (pfs::binary_istream<Endianess, Source> & in, A & a)
 {
     in >> a.ch;
 }
 
-template <pfs::endian Endianess>
-void deserialize (std::string const & sample_string)
+template <pfs::endian Endianess, typename Source>
+void deserialize (pfs::binary_istream<Endianess, Source> & in)
 {
-    using binary_istream_t = pfs::binary_istream<Endianess>;
-
-    binary_istream_t in {sample_string.data(), sample_string.size()};
-
     bool b = false;
     in >> b;
     CHECK_EQ(b, true);
@@ -141,6 +149,27 @@ void deserialize (std::string const & sample_string)
     A a {'\x00'};
     in >> a;
     CHECK_EQ(a.ch, 'x');
+
+    CHECK(in.is_good());
+}
+
+template <pfs::endian Endianess>
+void deserialize (std::string const & sample_string)
+{
+    using binary_istream_t = pfs::binary_istream<Endianess>;
+
+    binary_istream_t in {sample_string.data(), sample_string.size()};
+    deserialize(in);
+}
+
+template <pfs::endian Endianess>
+void deserialize_streamed (std::string const & sample_string, std::size_t buffer_size)
+{
+    using binary_istream_t = pfs::binary_istream<Endianess, pfs::istream_source>;
+
+    std::istringstream iss {sample_string};
+    binary_istream_t in {pfs::istream_source{iss}, buffer_size};
+    deserialize(in);
 }
 
 template <pfs::endian Endianess>
@@ -232,6 +261,136 @@ TEST_CASE("basic deserialization") {
     deserialize<pfs::endian::little>(s_sample_data_le);
 }
 
+TEST_CASE("streamed deserialization") {
+    for (std::size_t buffer_size: {1, 3, 8, 64, 1024}) {
+        deserialize_streamed<pfs::endian::big>(s_sample_data_be, buffer_size);
+        deserialize_streamed<pfs::endian::little>(s_sample_data_le, buffer_size);
+    }
+}
+
+TEST_CASE("streamed transactions") {
+    // Records: 16-bit length followed by payload
+    std::string source;
+
+    for (int i = 0; i < 100; i++) {
+        std::string payload(static_cast<std::size_t>(i), static_cast<char>('a' + i % 26));
+        source.push_back(static_cast<char>(payload.size() & 0xFF));
+        source.push_back(static_cast<char>((payload.size() >> 8) & 0xFF));
+        source += payload;
+    }
+
+    // Truncated record
+    source += std::string("\x10\x00truncated", 11);
+
+    std::istringstream iss {source};
+    pfs::binary_istream<pfs::endian::little, pfs::istream_source> in {pfs::istream_source{iss}, 16};
+
+    int count = 0;
+
+    while (!in.at_end()) {
+        std::uint16_t sz = 0;
+        std::string payload;
+
+        in.start_transaction();
+        in >> sz;
+        in.read(payload, sz);
+
+        if (!in.commit_transaction())
+            break;
+
+        CHECK_EQ(payload, std::string(static_cast<std::size_t>(count), static_cast<char>('a' + count % 26)));
+        count++;
+    }
+
+    CHECK_EQ(count, 100);
+    CHECK(in.is_good());
+
+    // Position is restored to the beginning of the truncated record
+    std::uint16_t sz = 0;
+    std::string payload;
+    in >> sz;
+    CHECK_EQ(sz, 16);
+    in.read(payload, 9);
+    CHECK_EQ(payload, std::string{"truncated"});
+    CHECK(in.at_end());
+
+    in.start_transaction();
+    in.skip(1);
+    CHECK_FALSE(in.commit_transaction());
+    CHECK(in.is_good());
+    CHECK_FALSE(in.source_error());
+}
+
+TEST_CASE("streamed deserialization from stream with exceptions") {
+    std::istringstream iss {std::string{"\x2A\x00\x00\x00Hel", 7}};
+    iss.exceptions(std::ios::failbit | std::ios::badbit);
+
+    pfs::binary_istream<pfs::endian::little, pfs::istream_source> in {pfs::istream_source{iss}, 16};
+
+    std::uint32_t value = 0;
+    std::string text;
+
+    // Short read of the whole stream sets failbit
+    in >> value;
+    CHECK_EQ(value, 42);
+    in.read(text, 3);
+    CHECK_EQ(text, std::string{"Hel"});
+    CHECK(in.is_good());
+
+    // Read past the end of the stream
+    in.read(text, 5);
+    CHECK_FALSE(in.is_good());
+    CHECK_FALSE(in.source_error());
+
+    // Exception of the stream buffer is not propagated
+    struct throwing_buf: std::streambuf
+    {
+        int_type underflow () override
+        {
+            throw std::runtime_error {"stream buffer failure"};
+        }
+    } buf;
+
+    std::istream is {& buf};
+    is.exceptions(std::ios::badbit);
+
+    pfs::binary_istream<pfs::endian::little, pfs::istream_source> in2 {pfs::istream_source{is}, 16};
+    in2 >> value;
+    CHECK_FALSE(in2.is_good());
+    CHECK_EQ(in2.source_error(), std::make_error_code(std::errc::io_error));
+}
+
+#if !_MSC_VER
+TEST_CASE("streamed deserialization from file descriptor") {
+    std::string source {"\x2A\x00\x00\x00Hello", 9};
+
+    int fds[2];
+    REQUIRE_EQ(::pipe(fds), 0);
+    REQUIRE_EQ(::write(fds[1], source.data(), source.size()), static_cast<ssize_t>(source.size()));
+    ::close(fds[1]);
+
+    pfs::binary_istream<pfs::endian::little, pfs::fd_source> in {pfs::fd_source{fds[0]}, 2};
+
+    std::int32_t i32 = 0;
+    std::string hello;
+    in >> i32;
+    in.read(hello, 5);
+
+    CHECK_EQ(i32, 42);
+    CHECK_EQ(hello, std::string{"Hello"});
+    CHECK(in.is_good());
+    CHECK_FALSE(in.at_end()); // End of data is not detected yet
+
+    char ch = 0;
+    in >> ch;
+    CHECK_FALSE(in.is_good());
+    CHECK(in.at_end());
+    CHECK_FALSE(in.source_error());
+
+    ::close(fds[0]);
+}
+#endif
+
 TEST_CASE("Universal ID deserialization") {
     deserialize_universal_id<pfs::endian::big>();
     deserialize_universal_id<pfs::endian::little>();
@@ -246,3 +405,66 @@ TEST_CASE("Timepoint deserialization") {
     deserialize_filesystem_path<pfs::endian::big>();
     deserialize_filesystem_path<pfs::endian::little>();
 }
+
+TEST_CASE("nested transactions") {
+    std::string source {"\x01\x02\x03\x04\x05\x06\x07\x08", 8};
+    pfs::binary_istream<> in {source.data(), source.size()};
+
+    // Deeper than inline checkpoints storage
+    int depth = PFS__BINARY_ISTREAM_INLINE_CHECKPOINTS + 3;
+
+    for (int i = 0; i < depth; i++) {
+        in.start_transaction();
+        in.skip(1);
+    }
+
+    for (int i = depth; i > 0; i--) {
+        CHECK_EQ(in.available(), source.size() - static_cast<std::size_t>(i));
+        in.rollback_transaction();
+    }
+
+    CHECK_EQ(in.available(), source.size());
+
+    in.start_transaction();
+    in.skip(4);
+    in.start_transaction();
+    in.skip(5);
+    CHECK_FALSE(in.commit_transaction());
+    CHECK(in.is_good());
+    CHECK_EQ(in.available(), 4);
+    CHECK(in.commit_transaction());
+    CHECK_EQ(in.available(), 4);
+}
+
+// Frames: 32-bit length followed by payload. The last frame is received partially, so
+// each pass parses complete frames and rolls back the incomplete one.
+TEST_CASE("benchmark") {
+    std::vector<char> buffer;
+    pfs::binary_ostream<pfs::endian::network> out {buffer};
+
+    for (int i = 0; i < 1000; i++) {
+        std::string payload(static_cast<std::size_t>(16 + i % 64), 'x');
+        out << static_cast<std::uint32_t>(payload.size()) << payload;
+    }
+
+    out << std::uint32_t{128} << std::string(64, 'y');
+
+    ankerl::nanobench::Bench().title("Frame parsing").minEpochIterations(100).run("binary_istream transactions", [& buffer] {
+        pfs::binary_istream<pfs::endian::network> in {buffer.data(), buffer.size()};
+        int count = 0;
+
+        while (!in.at_end()) {
+            std::uint32_t sz = 0;
+            in.start_transaction();
+            in >> sz;
+            in.skip(sz);
+
+            if (!in.commit_transaction())
+                break;
+
+            count++;
+        }
+
+        ankerl::nanobench::doNotOptimizeAway(count);
+    });
+}
@@ -5,12 +5,36 @@
 //
 // Changelog:
 //      2021.10.03 Initial version.
+//      2026.10.19 Added CRC32 slicing-by-8 tests and benchmark.
+//      2026.10.19 Added hardware accelerated kernels tests.
+//      2026.10.19 Added CRC combine tests.
+//      2026.10.19 Added compile-time CRC tests.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
 #include "doctest.h"
+#include "nanobench.h"
 #include "pfs/crc16.hpp"
 #include "pfs/crc32.hpp"
+#include "pfs/crc32c.hpp"
 #include "pfs/crc64.hpp"
+#include "pfs/parallel_crc.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<std::uint8_t> random_bytes (std::size_t n)
+{
+    std::mt19937 gen {42};
+    std::uniform_int_distribution<int> dist {0, 255};
+    std::vector<std::uint8_t> result(n);
+
+    for (auto & b: result)
+        b = static_cast<std::uint8_t>(dist(gen));
+
+    return result;
+}
 
 TEST_CASE("crc16_32_64_of") {
     using pfs::crc16_of;
@@ -94,3 +118,193 @@ TEST_CASE("crc16_32_64_of") {
         CHECK_EQ(c64, b64);
     }
 }
+
+TEST_CASE("crc32 slicing-by-8") {
+    CHECK_EQ(pfs::crc32_of_ptr("123456789", 9), static_cast<std::int32_t>(0xCBF43926));
+    CHECK_EQ(pfs::crc32_of_ptr("The quick brown fox jumps over the lazy dog", 43)
+        , static_cast<std::int32_t>(0x414FA339));
+
+    auto data = random_bytes(4096);
+
+    // Different lengths and misaligned starts
+    for (std::size_t offset = 0; offset < 8; offset++) {
+        for (std::size_t n = 0; n < 300; n++) {
+            auto p = data.data() + offset;
+            auto expected = pfs::details::crc32_update_bytewise(0xFFFFFFFF, p, n);
+            CHECK_EQ(pfs::details::crc32_update_slicing8(0xFFFFFFFF, p, n), expected);
+            CHECK_EQ(pfs::crc32_of_ptr(p, n), static_cast<std::int32_t>(expected ^ 0xFFFFFFFF));
+        }
+    }
+
+    // Continuation
+    auto whole = pfs::crc32_of_ptr(data.data(), data.size());
+    auto part = pfs::crc32_of_ptr(data.data(), 1000);
+    CHECK_EQ(pfs::crc32_of_ptr(data.data() + 1000, data.size() - 1000, part), whole);
+}
+
+TEST_CASE("crc32c") {
+    CHECK_EQ(pfs::crc32c_of_ptr("", 0), 0);
+    CHECK_EQ(pfs::crc32c_of_ptr("123456789", 9), static_cast<std::int32_t>(0xE3069283));
+    CHECK_EQ(pfs::crc32c_of(std::string(32, '\0')), static_cast<std::int32_t>(0x8A9136AA));
+
+    auto data = random_bytes(4096);
+
+    for (std::size_t offset = 0; offset < 8; offset++) {
+        for (std::size_t n = 0; n < 300; n++) {
+            auto p = data.data() + offset;
+            auto expected = pfs::details::crc32c_update_table(0xFFFFFFFF, p, n);
+            CHECK_EQ(pfs::crc32c_of_ptr(p, n), static_cast<std::int32_t>(expected ^ 0xFFFFFFFF));
+
+#if PFS__X86_INTRINSICS_ENABLED
+            if (pfs::cpu_features().sse42)
+                CHECK_EQ(pfs::details::crc32c_update_sse42(0xFFFFFFFF, p, n), expected);
+#endif
+        }
+    }
+
+    auto whole = pfs::crc32c_of_ptr(data.data(), data.size());
+    auto part = pfs::crc32c_of_ptr(data.data(), 1000);
+    CHECK_EQ(pfs::crc32c_of_ptr(data.data() + 1000, data.size() - 1000, part), whole);
+}
+
+#if PFS__X86_INTRINSICS_ENABLED
+TEST_CASE("crc pclmul") {
+    if (!pfs::cpu_features().pclmul) {
+        MESSAGE("PCLMULQDQ is not supported by CPU, tests skipped");
+        return;
+    }
+
+    auto data = random_bytes(8192);
+
+    for (std::size_t offset = 0; offset < 16; offset++) {
+        for (std::size_t n = 0; n < 1100; n += (n < 300 ? 1 : 7)) {
+            auto p = data.data() + offset;
+
+            for (std::uint32_t r32: {0u, 0xFFFFFFFFu, 0x12345678u}) {
+                CHECK_EQ(pfs::details::crc32_update_pclmul(r32, p, n)
+                    , pfs::details::crc32_update_bytewise(r32, p, n));
+            }
+
+            for (std::uint64_t r64: {std::uint64_t{0}, ~std::uint64_t{0}, std::uint64_t{0x0123456789ABCDEF}}) {
+                CHECK_EQ(pfs::details::crc64_update_pclmul(r64, p, n)
+                    , pfs::details::crc64_update_bytewise(r64, p, n));
+            }
+        }
+    }
+
+    // Large input through public API (dispatched to PCLMULQDQ kernel)
+    auto large = random_bytes(1024 * 1024 + 13);
+    CHECK_EQ(pfs::crc32_of_ptr(large.data(), large.size())
+        , static_cast<std::int32_t>(pfs::details::crc32_update_bytewise(0xFFFFFFFF, large.data(), large.size()) ^ 0xFFFFFFFF));
+    CHECK_EQ(pfs::crc64_of_ptr(large.data(), large.size())
+        , static_cast<std::int64_t>(pfs::details::crc64_update_bytewise(0, large.data(), large.size())));
+}
+#endif
+
+TEST_CASE("crc combine") {
+    auto data = random_bytes(3 * 1024 * 1024 + 7);
+
+    for (std::size_t len1: {std::size_t{0}, std::size_t{1}, std::size_t{100}, std::size_t{4096}}) {
+        for (std::size_t len2: {std::size_t{0}, std::size_t{1}, std::size_t{17}, std::size_t{1000}, std::size_t{65536}}) {
+            auto p = data.data();
+
+            CHECK_EQ(pfs::crc32_combine(pfs::crc32_of_ptr(p, len1), pfs::crc32_of_ptr(p + len1, len2), len2)
+                , pfs::crc32_of_ptr(p, len1 + len2));
+            CHECK_EQ(pfs::crc64_combine(pfs::crc64_of_ptr(p, len1), pfs::crc64_of_ptr(p + len1, len2), len2)
+                , pfs::crc64_of_ptr(p, len1 + len2));
+        }
+    }
+
+    // crc32_state
+    {
+        pfs::crc32_state state;
+        pfs::crc32_state tail;
+
+        state.update(data.data(), 1000);
+        state.update(data.data() + 1000, 3000);
+        tail.update(data.data() + 4000, 5000);
+        state.append(tail);
+        state.append(pfs::crc32_of_ptr(data.data() + 9000, 1000), 1000);
+
+        CHECK_EQ(state.size(), 10000);
+        CHECK_EQ(state.value(), pfs::crc32_of_ptr(data.data(), 10000));
+
+        state.reset();
+        CHECK_EQ(state.size(), 0);
+        CHECK_EQ(state.value(), 0);
+    }
+
+    // Parallel
+    for (unsigned nthreads: {0u, 1u, 2u, 3u, 8u}) {
+        CHECK_EQ(pfs::parallel_crc32(data.data(), data.size(), nthreads), pfs::crc32_of_ptr(data.data(), data.size()));
+        CHECK_EQ(pfs::parallel_crc32(data.data(), data.size(), nthreads, 42), pfs::crc32_of_ptr(data.data(), data.size(), 42));
+        CHECK_EQ(pfs::parallel_crc64(data.data(), data.size(), nthreads), pfs::crc64_of_ptr(data.data(), data.size()));
+        CHECK_EQ(pfs::parallel_crc64(data.data(), data.size(), nthreads, 42), pfs::crc64_of_ptr(data.data(), data.size(), 42));
+    }
+
+    CHECK_EQ(pfs::parallel_crc32(data.data(), 10, 4), pfs::crc32_of_ptr(data.data(), 10));
+}
+
+TEST_CASE("constexpr crc") {
+    // Check values from the CRC catalogue
+    static_assert(pfs::crc16_of_literal("123456789") == static_cast<std::int16_t>(0x31C3), "");
+    static_assert(pfs::crc32_of_literal("123456789") == static_cast<std::int32_t>(0xCBF43926), "");
+    static_assert(pfs::crc32c_of_literal("123456789") == static_cast<std::int32_t>(0xE3069283), "");
+    static_assert(pfs::crc32_of_literal("") == 0, "");
+
+    // CRC-8/SMBUS, CRC-16/ARC, CRC-32/BZIP2 (non-reflected), CRC-64/ECMA-182
+    static_assert(pfs::crc<8, 0x07, false>::of_literal("123456789") == 0xF4, "");
+    static_assert(pfs::crc<16, 0x8005, true>::of_literal("123456789") == 0xBB3D, "");
+    static_assert((pfs::crc<32, 0x04C11DB7, false>::of_literal("123456789", 0xFFFFFFFF) ^ 0xFFFFFFFF) == 0xFC891918, "");
+    static_assert(pfs::crc<64, 0x42F0E1EBA9EA3693, false>::of_literal("123456789") == 0x6C40DF5F0B497347, "");
+
+    // Usable as dispatch keys
+    constexpr auto key = pfs::crc32_of_literal("message_type");
+
+    switch (pfs::crc32_of(std::string{"message_type"})) {
+        case key:
+            break;
+        default:
+            FAIL("unexpected key");
+    }
+
+    CHECK_EQ(pfs::crc16_of_literal("message_type"), pfs::crc16_of(std::string{"message_type"}));
+    CHECK_EQ(pfs::crc32_of_literal("message_type", 42), pfs::crc32_of(std::string{"message_type"}, 42));
+    CHECK_EQ(pfs::crc32c_of_literal("message_type"), pfs::crc32c_of(std::string{"message_type"}));
+    CHECK_EQ(pfs::crc64_of_literal("message_type", 42), pfs::crc64_of(std::string{"message_type"}, 42));
+}
+
+TEST_CASE("crc32 benchmark") {
+    auto data = random_bytes(64 * 1024 * 1024);
+
+    for (std::size_t n: {std::size_t{64}, std::size_t{1024}, std::size_t{64 * 1024}
+            , std::size_t{1024 * 1024}, std::size_t{64 * 1024 * 1024}}) {
+        ankerl::nanobench::Bench bench;
+        bench.title("CRC32 " + std::to_string(n) + " bytes").unit("byte").batch(n);
+
+        if (n >= 1024 * 1024)
+            bench.epochs(3).epochIterations(1);
+
+        bench.run("bytewise", [& data, n] {
+            ankerl::nanobench::doNotOptimizeAway(pfs::details::crc32_update_bytewise(0xFFFFFFFF, data.data(), n));
+        });
+
+        bench.run("slicing-by-8", [& data, n] {
+            ankerl::nanobench::doNotOptimizeAway(pfs::details::crc32_update_slicing8(0xFFFFFFFF, data.data(), n));
+        });
+
+#if PFS__X86_INTRINSICS_ENABLED
+        if (pfs::cpu_features().pclmul) {
+            bench.run("pclmul", [& data, n] {
+                ankerl::nanobench::doNotOptimizeAway(pfs::details::crc32_update_pclmul(0xFFFFFFFF, data.data(), n));
+            });
+        }
+
+        if (pfs::cpu_features().sse42) {
+            bench.run("crc32c sse4.2", [& data, n] {
+                ankerl::nanobench::doNotOptimizeAway(pfs::details::crc32c_update_sse42(0xFFFFFFFF, data.data(), n));
+            });
+        }
+#endif
+    }
+}
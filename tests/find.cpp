@@ -5,11 +5,18 @@
 //
 // Changelog:
 //      2021.07.06 Initial version.
+//      2026.10.19 Added tests and benchmarks for contiguous `char` sequences.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
 #include "doctest.h"
+#include "nanobench.h"
 #include "pfs/find.hpp"
+#include <algorithm>
+#include <list>
+#include <random>
 #include <string>
+#include <vector>
 
 TEST_CASE("find") {
     using pfs::find;
@@ -61,3 +68,126 @@ TEST_CASE("find") {
     }
 
 }
+
+using find_chars_func = char const * (*) (char const *, std::size_t, char const *, std::size_t);
+
+static std::vector<std::pair<char const *, find_chars_func>> find_chars_kernels ()
+{
+    std::vector<std::pair<char const *, find_chars_func>> result {
+          {"find_chars", pfs::details::find_chars}
+        , {"memchr", pfs::details::find_chars_memchr}
+        , {"horspool", pfs::details::find_chars_horspool}
+    };
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (pfs::cpu_features().sse2)
+        result.emplace_back("sse2", pfs::details::find_chars_sse2);
+
+    if (pfs::cpu_features().avx2)
+        result.emplace_back("avx2", pfs::details::find_chars_avx2);
+#endif
+
+    return result;
+}
+
+// Haystack of small alphabet to produce many partial matches
+static std::string random_text (std::size_t n, char alphabet_last, unsigned seed = 42)
+{
+    std::mt19937 gen {seed};
+    std::uniform_int_distribution<int> dist {'a', alphabet_last};
+    std::string result(n, '\0');
+
+    for (auto & c: result)
+        c = static_cast<char>(dist(gen));
+
+    return result;
+}
+
+TEST_CASE("contiguous") {
+    std::mt19937 gen {7};
+
+    for (auto kernel: find_chars_kernels()) {
+        for (char alphabet_last: {'b', 'd', 'z'}) {
+            auto haystack = random_text(300, alphabet_last);
+
+            for (int k = 0; k < 300; k++) {
+                std::size_t nn = 2 + gen() % 80;
+                std::size_t pos = gen() % haystack.size();
+                std::size_t hn = gen() % (haystack.size() + 1);
+                std::string needle = haystack.substr(pos, nn);
+
+                if (k % 3 == 0 && !needle.empty())
+                    needle.back() = 'y';
+
+                if (needle.size() < 2 || needle.size() > hn)
+                    continue;
+
+                auto expected = std::search(haystack.data(), haystack.data() + hn
+                    , needle.data(), needle.data() + needle.size());
+                auto p = kernel.second(haystack.data(), hn, needle.data(), needle.size());
+
+                if (expected == haystack.data() + hn)
+                    expected = nullptr;
+
+                CHECK_MESSAGE(p == expected, kernel.first);
+            }
+        }
+    }
+
+    // Iterators of different containers
+    std::string haystack {"Hello, World!"};
+    std::vector<char> needle {'W', 'o', 'r'};
+    std::list<char> lhaystack(haystack.begin(), haystack.end());
+
+    auto r1 = pfs::find(haystack.cbegin(), haystack.cend(), needle.begin(), needle.end());
+    auto r2 = pfs::find(lhaystack.begin(), lhaystack.end(), needle.begin(), needle.end());
+
+    CHECK_EQ(r1.first, haystack.cbegin() + 7);
+    CHECK_EQ(r1.second, haystack.cbegin() + 10);
+    CHECK_EQ(std::distance(lhaystack.begin(), r2.first), 7);
+
+    char const * text = "abcabd";
+    char const * pattern = "abd";
+    auto r3 = pfs::find(text, text + 6, pattern, pattern + 3);
+    CHECK_EQ(r3.first, text + 3);
+    CHECK_EQ(r3.second, text + 6);
+
+    auto r4 = pfs::find(text, text + 6, pattern, pattern);
+    CHECK_EQ(r4.first, text + 6);
+}
+
+TEST_CASE("benchmark") {
+    auto haystack = random_text(1024 * 1024, 'y');
+    auto hb = haystack.data();
+    auto he = haystack.data() + haystack.size();
+
+    for (std::size_t nn: {1, 4, 16, 100, 256, 1000}) {
+        // Needle of the same alphabet is at the end of the haystack only
+        auto needle = random_text(nn - 1, 'y', 1) + 'z';
+        std::copy(needle.begin(), needle.end(), haystack.end() - static_cast<std::ptrdiff_t>(nn));
+
+        ankerl::nanobench::Bench bench;
+        bench.title("find, needle " + std::to_string(nn)).batch(haystack.size()).unit("byte")
+            .minEpochIterations(3);
+
+        bench.run("generic", [&] {
+            auto r = pfs::details::find(hb, he, needle.cbegin(), needle.cend(), std::false_type{});
+            ankerl::nanobench::doNotOptimizeAway(r);
+        });
+
+        bench.run("std::search", [&] {
+            auto r = std::search(hb, he, needle.cbegin(), needle.cend());
+            ankerl::nanobench::doNotOptimizeAway(r);
+        });
+
+        for (auto kernel: find_chars_kernels()) {
+            bench.run(kernel.first, [&] {
+                auto r = kernel.second(hb, haystack.size(), needle.data(), nn);
+                ankerl::nanobench::doNotOptimizeAway(r);
+            });
+        }
+
+        CHECK_EQ(pfs::find(haystack.cbegin(), haystack.cend(), needle.cbegin(), needle.cend()).first
+            , haystack.cend() - static_cast<std::ptrdiff_t>(nn));
+    }
+}
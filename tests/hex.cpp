@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/hex.hpp"
+#include "pfs/sha256.hpp"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<std::uint8_t> random_bytes (std::size_t n)
+{
+    std::mt19937 gen {42};
+    std::uniform_int_distribution<int> dist {0, 255};
+    std::vector<std::uint8_t> result(n);
+
+    for (auto & b: result)
+        b = static_cast<std::uint8_t>(dist(gen));
+
+    return result;
+}
+
+// Reference encoding
+static std::string naive_hex (std::uint8_t const * data, std::size_t n, bool uppercase)
+{
+    std::string result;
+    char buf[3];
+
+    for (std::size_t i = 0; i < n; i++) {
+        std::snprintf(buf, sizeof(buf), uppercase ? "%02X" : "%02x", data[i]);
+        result += buf;
+    }
+
+    return result;
+}
+
+TEST_CASE("to_hex") {
+    CHECK_EQ(pfs::to_hex(std::vector<std::uint8_t>{}), std::string{});
+    CHECK_EQ(pfs::to_hex(std::vector<std::uint8_t>{0x00, 0x7F, 0x80, 0xAB, 0xFF}), "007f80abff");
+    CHECK_EQ(pfs::to_hex(std::vector<std::uint8_t>{0x00, 0x7F, 0x80, 0xAB, 0xFF}, true), "007F80ABFF");
+
+    auto bytes = random_bytes(300);
+
+    // Lengths and offsets cover SIMD blocks and scalar tails
+    for (std::size_t offset = 0; offset < 4; offset++) {
+        for (std::size_t n = 0; n + offset <= bytes.size(); n += 7) {
+            CHECK_EQ(pfs::to_hex(bytes.data() + offset, n), naive_hex(bytes.data() + offset, n, false));
+            CHECK_EQ(pfs::to_hex(bytes.data() + offset, n, true), naive_hex(bytes.data() + offset, n, true));
+        }
+    }
+}
+
+TEST_CASE("from_hex") {
+    auto bytes = random_bytes(300);
+
+    for (std::size_t n = 0; n <= bytes.size(); n += 5) {
+        auto hex = pfs::to_hex(bytes.data(), n, n % 2 == 0);
+        std::vector<std::uint8_t> decoded(n);
+
+        REQUIRE_EQ(pfs::from_hex(hex.data(), hex.size(), decoded.data()), hex.size());
+        CHECK(std::equal(decoded.begin(), decoded.end(), bytes.begin()));
+    }
+
+    // Mixed case
+    CHECK_EQ(pfs::from_hex("aBcDeF0123456789"), std::vector<std::uint8_t>{0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45, 0x67, 0x89});
+
+    // First invalid character is reported for each position (and each SIMD path)
+    auto hex = pfs::to_hex(bytes.data(), 100);
+
+    for (char bad: {'g', 'G', '/', ':', '@', '`', ' ', '\0', '\x80', '\xB0', '\xE6'}) {
+        for (std::size_t pos = 0; pos < hex.size(); pos++) {
+            auto s = hex;
+            s[pos] = bad;
+
+            // The second invalid character must not be reported
+            if (pos + 3 < s.size())
+                s[pos + 3] = 'x';
+
+            std::error_code ec;
+            std::size_t error_pos = 0;
+            auto result = pfs::from_hex(s, ec, & error_pos);
+
+            CHECK(ec);
+            CHECK(result.empty());
+            CHECK_EQ(error_pos, pos);
+        }
+    }
+
+    // Odd length
+    std::error_code ec;
+    std::size_t error_pos = 0;
+    pfs::from_hex(std::string{"abc"}, ec, & error_pos);
+    CHECK_EQ(ec, std::make_error_code(std::errc::invalid_argument));
+    CHECK_EQ(error_pos, 2);
+
+    CHECK_THROWS_AS(pfs::from_hex("0z"), pfs::error);
+}
+
+TEST_CASE("digest") {
+    auto digest = pfs::crypto::sha256::digest(std::string{"The quick brown fox jumps over the lazy dog"});
+    auto s = to_string(digest);
+
+    CHECK_EQ(s, "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592");
+
+    std::error_code ec;
+    CHECK_EQ(pfs::crypto::to_sha256_digest(s, ec), digest);
+    CHECK_FALSE(ec);
+
+    s[63] = 'x';
+    pfs::crypto::to_sha256_digest(s, ec);
+    CHECK(ec);
+}
+
+TEST_CASE("benchmark") {
+    auto bytes = random_bytes(1024 * 1024);
+    auto hex = pfs::to_hex(bytes.data(), bytes.size());
+    std::vector<std::uint8_t> decoded(bytes.size());
+    std::string out(2 * bytes.size(), '\0');
+
+    ankerl::nanobench::Bench().batch(bytes.size()).unit("byte").minEpochIterations(5)
+        .run("to_hex scalar", [&] {
+            pfs::details::hex_encode_scalar(bytes.data(), bytes.size(), & out[0], false);
+            ankerl::nanobench::doNotOptimizeAway(out);
+        })
+        .run("to_hex", [&] {
+            pfs::to_hex(bytes.data(), bytes.size(), & out[0]);
+            ankerl::nanobench::doNotOptimizeAway(out);
+        })
+        .run("from_hex scalar", [&] {
+            pfs::details::hex_decode_scalar(hex.data(), bytes.size(), decoded.data());
+            ankerl::nanobench::doNotOptimizeAway(decoded);
+        })
+        .run("from_hex", [&] {
+            pfs::from_hex(hex.data(), hex.size(), decoded.data());
+            ankerl::nanobench::doNotOptimizeAway(decoded);
+        });
+
+    std::vector<pfs::crypto::sha256_digest> digests(1000);
+
+    for (std::size_t i = 0; i < digests.size(); i++)
+        std::copy(bytes.begin() + i * 32, bytes.begin() + i * 32 + 32, digests[i].begin());
+
+    ankerl::nanobench::Bench().batch(digests.size()).unit("digest").minEpochIterations(5)
+        .run("to_string(sha256_digest)", [&] {
+            for (auto const & d: digests)
+                ankerl::nanobench::doNotOptimizeAway(to_string(d));
+        });
+}
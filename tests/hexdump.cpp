@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/hexdump.hpp"
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+static std::string const expected_16 =
+      "00000000  41 42 43 00 7F 80 FF 20 7E 0A 61 62 63 64 65 66  ABC.... ~.abcdef\n"
+      "00000010  67 68                                            gh\n";
+
+static std::string const expected_4 =
+      "00000000  41 42 43 00  ABC.\n"
+      "00000004  7F 80 FF 20  ... \n"
+      "00000008  7E 0A 61 62  ~.ab\n"
+      "0000000C  63 64 65 66  cdef\n"
+      "00000010  67 68        gh\n";
+
+static std::string const data {"ABC\0\x7F\x80\xFF ~\nabcdefgh", 18};
+
+TEST_CASE("hexdump") {
+    CHECK_EQ(pfs::hexdump(data.begin(), data.end()), expected_16);
+    CHECK_EQ(pfs::hexdump(data.begin(), data.end(), 4), expected_4);
+    CHECK_EQ(pfs::hexdump(data.begin(), data.begin()), std::string{});
+}
+
+TEST_CASE("streaming") {
+    // Input iterator without random access
+    std::list<char> bytes(data.begin(), data.end());
+    std::string result;
+
+    pfs::hexdump(bytes.begin(), bytes.end(), std::back_inserter(result), 4);
+    CHECK_EQ(result, expected_4);
+
+    auto f = std::tmpfile();
+    REQUIRE(f != nullptr);
+    CHECK(pfs::hexdump(data.begin(), data.end(), f));
+
+    std::vector<char> buf(expected_16.size() + 1);
+    std::rewind(f);
+    CHECK_EQ(std::fread(buf.data(), 1, buf.size(), f), expected_16.size());
+    CHECK_EQ(std::string(buf.data(), expected_16.size()), expected_16);
+    std::fclose(f);
+}
+
+TEST_CASE("benchmark") {
+    std::vector<std::uint8_t> bytes(1024 * 1024);
+
+    for (std::size_t i = 0; i < bytes.size(); i++)
+        bytes[i] = static_cast<std::uint8_t>(i * 7);
+
+    ankerl::nanobench::Bench().batch(bytes.size()).unit("byte").minEpochIterations(3)
+        .run("hexdump 1 MiB", [&] {
+            auto dump = pfs::hexdump(bytes.begin(), bytes.end());
+            ankerl::nanobench::doNotOptimizeAway(dump);
+        });
+}
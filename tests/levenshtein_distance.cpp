@@ -5,13 +5,19 @@
 //
 // Changelog:
 //      2023.04.12 Initial version.
+//      2026.10.19 Added tests and benchmark for `hyyro2003` algorithm.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
 #include "doctest.h"
+#include "nanobench.h"
 #include "pfs/fmt.hpp"
 #include "pfs/levenshtein_distance.hpp"
 #include "pfs/unicode/utf8_iterator.hpp"
 #include <cctype>
+#include <random>
+#include <string>
+#include <vector>
 
 struct test_suite_entry
 {
@@ -68,6 +74,7 @@ TEST_CASE("levenshtein_distance")
     auto wagner_fischer = pfs::levenshtein_distance_algo::wagner_fischer;
     auto fast = pfs::levenshtein_distance_algo::fast;
     auto myers1999 = pfs::levenshtein_distance_algo::myers1999;
+    auto hyyro2003 = pfs::levenshtein_distance_algo::hyyro2003;
     auto hamming = pfs::levenshtein_distance_algo::hamming;
 
     // Special cases
@@ -92,6 +99,8 @@ TEST_CASE("levenshtein_distance")
             , fmt::format(R"(levenshtein_distance("{}", "{}", fast))", x.a, x.b));
         CHECK_MESSAGE(pfs::levenshtein_distance<>(x.a, x.b, myers1999) == x.fast_result
             , fmt::format(R"(levenshtein_distance("{}", "{}", myers1999))", x.a, x.b));
+        CHECK_MESSAGE(pfs::levenshtein_distance<>(x.a, x.b, hyyro2003) == x.fast_result
+            , fmt::format(R"(levenshtein_distance("{}", "{}", hyyro2003))", x.a, x.b));
 
         if (std::strcmp(x.a, x.b) == 0) {
             CHECK_MESSAGE(pfs::levenshtein_distance<>(x.a, x.b, hamming) == x.fast_result
@@ -115,6 +124,7 @@ TEST_CASE("levenshtein_distance ignore case")
 
     auto wagner_fischer = pfs::levenshtein_distance_algo::wagner_fischer;
     auto fast = pfs::levenshtein_distance_algo::fast;
+    auto hyyro2003 = pfs::levenshtein_distance_algo::hyyro2003;
 
     for (auto const & x: test_suite) {
         CHECK_EQ(pfs::levenshtein_distance<char const *
@@ -123,6 +133,9 @@ TEST_CASE("levenshtein_distance ignore case")
         CHECK_EQ(pfs::levenshtein_distance<char const *
             , ignorecase_equality_comparator>(x.a, x.b, fast)
             , x.fast_result);
+        CHECK_EQ(pfs::levenshtein_distance<char const *
+            , ignorecase_equality_comparator>(x.a, x.b, hyyro2003)
+            , x.fast_result);
     }
 }
 #endif
@@ -148,3 +161,106 @@ TEST_CASE("levenshtein_distance for UTF8")
         CHECK_EQ(distance(xbegin, xbegin.end(), ybegin, ybegin.end()), x.result);
     }
 }
+
+TEST_CASE("levenshtein_distance hyyro2003 for UTF8")
+{
+    using utf8_input_iterator = pfs::unicode::utf8_iterator<char const *>;
+    using eq_comparator = pfs::default_equality_comparator<pfs::pointer_dereference_t<utf8_input_iterator>>;
+    using levenshtein = pfs::levenshtein_distance_env<utf8_input_iterator, eq_comparator
+        , pfs::levenshtein_distance_algo::hyyro2003>;
+
+    levenshtein distance;
+
+    short_test_suite_entry test_suite[] = {
+          { 0, "АБВ"     , "АБВ" }
+        , { 1, "АБВ"     , "АБв" }
+        , { 1, "А"       , "а"   }
+        , { 2, "😀Ж𝄞"    , "Ж𝄞😀" }
+        , { 2, "中文字符" , "中字"  }
+    };
+
+    for (auto const & x: test_suite) {
+        auto xbegin = utf8_input_iterator::begin(x.a, x.a + std::strlen(x.a));
+        auto ybegin = utf8_input_iterator::begin(x.b, x.b + std::strlen(x.b));
+
+        CHECK_EQ(distance(xbegin, xbegin.end(), ybegin, ybegin.end()), x.result);
+    }
+}
+
+TEST_CASE("levenshtein_distance hyyro2003 random")
+{
+    std::mt19937 gen {42};
+
+    // Lengths around the block boundaries, small alphabet for many matches
+    std::size_t lengths[] = {1, 2, 31, 32, 33, 63, 64, 65, 127, 128, 129, 200, 300};
+
+    auto random_string = [& gen] (std::size_t n, char alphabet_last) {
+        std::string s;
+
+        for (std::size_t i = 0; i < n; i++)
+            s += static_cast<char>(std::uniform_int_distribution<int>{'a', alphabet_last}(gen));
+
+        return s;
+    };
+
+    for (auto xlen: lengths) {
+        for (auto ylen: lengths) {
+            for (char alphabet_last: {'b', 'e', 'z'}) {
+                auto x = random_string(xlen, alphabet_last);
+                auto y = random_string(ylen, alphabet_last);
+
+                // Similar strings too
+                auto z = x;
+
+                for (int i = 0; i < 5; i++)
+                    z[std::uniform_int_distribution<std::size_t>{0, z.size() - 1}(gen)] = 'A';
+
+                CAPTURE(x);
+                CAPTURE(y);
+                CHECK_EQ(pfs::levenshtein_distance(x, y, pfs::levenshtein_distance_algo::hyyro2003)
+                    , pfs::levenshtein_distance(x, y, pfs::levenshtein_distance_algo::fast));
+                CHECK_EQ(pfs::levenshtein_distance(x, z, pfs::levenshtein_distance_algo::hyyro2003)
+                    , pfs::levenshtein_distance(x, z, pfs::levenshtein_distance_algo::fast));
+                CHECK_EQ(pfs::levenshtein_distance<std::string::const_iterator, ignorecase_equality_comparator>(
+                      x.cbegin(), x.cend(), z.cbegin(), z.cend(), pfs::levenshtein_distance_algo::hyyro2003)
+                    , pfs::levenshtein_distance<std::string::const_iterator, ignorecase_equality_comparator>(
+                      x.cbegin(), x.cend(), z.cbegin(), z.cend(), pfs::levenshtein_distance_algo::fast));
+            }
+        }
+    }
+}
+
+TEST_CASE("levenshtein_distance benchmark")
+{
+    // Fuzzy matching of the product names of 200 characters
+    std::mt19937 gen {42};
+    std::vector<std::string> names;
+
+    for (int i = 0; i < 100; i++) {
+        std::string s;
+
+        while (s.size() < 200)
+            s += static_cast<char>(std::uniform_int_distribution<int>{'a', 'z'}(gen));
+
+        names.push_back(std::move(s));
+    }
+
+    auto query = names[0];
+    query[10] = 'X';
+    query.erase(100, 3);
+
+    auto bench = [&] (char const * name, pfs::levenshtein_distance_algo algo) {
+        ankerl::nanobench::Bench().batch(names.size()).unit("pair").minEpochIterations(3)
+            .title("200 characters").run(name, [&] {
+                std::ptrdiff_t sum = 0;
+
+                for (auto const & s: names)
+                    sum += pfs::levenshtein_distance(query, s, algo);
+
+                ankerl::nanobench::doNotOptimizeAway(sum);
+            });
+    };
+
+    bench("fast", pfs::levenshtein_distance_algo::fast);
+    bench("hyyro2003", pfs::levenshtein_distance_algo::hyyro2003);
+}
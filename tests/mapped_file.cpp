@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "pfs/binary_istream.hpp"
+#include "pfs/filesystem.hpp"
+#include "pfs/mapped_file.hpp"
+#include "pfs/sha256.hpp"
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace fs = pfs::filesystem;
+
+static fs::path write_temp_file (std::string const & name, std::string const & content)
+{
+    auto p = fs::temp_directory_path() / name;
+    std::ofstream ofs {pfs::utf8_encode_path(p), std::ios::binary | std::ios::trunc};
+    ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+    return p;
+}
+
+TEST_CASE("mapped_file") {
+    std::string content {"\x2A\x00\x00\x00The quick brown fox jumps over the lazy dog", 47};
+    auto p = write_temp_file("pfs-mapped_file.bin", content);
+
+    {
+        fs::mapped_file mf {p};
+
+        REQUIRE(mf);
+        REQUIRE_EQ(mf.size(), content.size());
+        CHECK_EQ(std::memcmp(mf.data(), content.data(), content.size()), 0);
+
+        pfs::binary_istream<pfs::endian::little> in {mf.data(), mf.size()};
+        std::int32_t i32 = 0;
+        std::string text;
+        in >> i32;
+        in.read(text, 43);
+
+        CHECK(in.is_good());
+        CHECK(in.at_end());
+        CHECK_EQ(i32, 42);
+        CHECK_EQ(text, content.substr(4));
+
+        fs::mapped_file mf1 {std::move(mf)};
+        CHECK_FALSE(mf);
+        CHECK(mf1);
+        CHECK_EQ(mf1.size(), content.size());
+    }
+
+    CHECK_EQ(pfs::crypto::sha256::digest(p), pfs::crypto::sha256::digest(content));
+    fs::remove(p);
+}
+
+TEST_CASE("mapped_file empty") {
+    auto p = write_temp_file("pfs-mapped_file-empty.bin", std::string{});
+
+    fs::mapped_file mf {p, fs::mapped_file::access_hint::random};
+
+    CHECK(mf);
+    CHECK(mf.empty());
+    CHECK_EQ(to_string(pfs::crypto::sha256::digest(p))
+        , "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+    pfs::binary_istream<> in {mf.data(), mf.size()};
+    CHECK(in.at_end());
+
+    fs::remove(p);
+}
+
+TEST_CASE("mapped_file failure") {
+    std::error_code ec;
+    fs::mapped_file mf {fs::temp_directory_path() / "pfs-mapped_file-nonexistent.bin", ec};
+
+    CHECK(ec);
+    CHECK_FALSE(mf);
+    CHECK_THROWS_AS(fs::mapped_file{fs::temp_directory_path() / "pfs-mapped_file-nonexistent.bin"}
+        , pfs::error);
+}
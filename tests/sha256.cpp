@@ -5,10 +5,63 @@
 //
 // Changelog:
 //      2021.12.06 Initial version.
+//      2026.10.19 Added backends tests and benchmark.
+//      2026.10.19 Added multi-buffer tests and benchmark.
+//      2026.10.19 Added parallel files hashing tests.
+//      2026.10.19 Added Merkle tree tests.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
 #include "doctest.h"
+#include "nanobench.h"
 #include "pfs/sha256.hpp"
+#include "pfs/sha256_tree.hpp"
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using pfs::crypto::sha256_backend;
+
+static std::vector<std::uint8_t> random_bytes (std::size_t n)
+{
+    std::mt19937 gen {42};
+    std::uniform_int_distribution<int> dist {0, 255};
+    std::vector<std::uint8_t> result(n);
+
+    for (auto & b: result)
+        b = static_cast<std::uint8_t>(dist(gen));
+
+    return result;
+}
+
+// Digest calculated by the reference (Colin Percival) implementation
+static pfs::crypto::sha256_digest reference_digest (std::uint8_t const * data, std::size_t n)
+{
+    pfs::crypto::details::sha256 hash;
+    pfs::crypto::sha256_digest result;
+    hash.update(data, n);
+    hash.final(result.data());
+    return result;
+}
+
+static std::vector<sha256_backend> const all_backends {
+      sha256_backend::portable
+    , sha256_backend::ssse3
+    , sha256_backend::avx2
+    , sha256_backend::shani
+};
+
+static char const * backend_name (sha256_backend backend)
+{
+    switch (backend) {
+        case sha256_backend::portable: return "portable";
+        case sha256_backend::ssse3: return "ssse3";
+        case sha256_backend::avx2: return "avx2";
+        case sha256_backend::shani: return "sha-ni";
+        default: return "automatic";
+    }
+}
 
 TEST_CASE("sha256") {
     CHECK_EQ(to_string(pfs::crypto::sha256::digest(""))
@@ -45,3 +98,337 @@ TEST_CASE("decode") {
     CHECK_EQ(pfs::crypto::to_sha256_digest("e4c4d8f3bf76b692de791a173e05321150f7a345b46484fe427f6acc7ecc81be", ec)
         , pfs::crypto::sha256::digest("The quick brown fox jumps over the lazy cog"));
 }
+
+TEST_CASE("backends") {
+    auto data = random_bytes(4096);
+
+    for (auto backend: all_backends) {
+        if (!pfs::crypto::sha256::supported(backend)) {
+            MESSAGE(backend_name(backend), " backend is not supported by CPU, tests skipped");
+            continue;
+        }
+
+        for (std::size_t n = 0; n < 1100; n += (n < 300 ? 1 : 13)) {
+            auto expected = reference_digest(data.data() + 1, n);
+
+            pfs::crypto::sha256 hash {backend};
+            hash.update(data.data() + 1, n);
+            CHECK_EQ(hash.digest(), expected);
+
+            // Chunked update
+            pfs::crypto::sha256 chunked {backend};
+            std::size_t offset = 0;
+
+            for (std::size_t chunk = 1; offset < n; chunk = chunk * 3 + 1) {
+                auto len = (std::min)(chunk, n - offset);
+                chunked.update(data.data() + 1 + offset, len);
+                offset += len;
+            }
+
+            CHECK_EQ(chunked.digest(), expected);
+        }
+    }
+
+    // Two-block message from FIPS 180-2
+    CHECK_EQ(to_string(pfs::crypto::sha256::digest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"))
+        , "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST_CASE("benchmark") {
+    auto data = random_bytes(1024 * 1024);
+
+    for (std::size_t n: {std::size_t{64}, std::size_t{1024}, std::size_t{1024 * 1024}}) {
+        ankerl::nanobench::Bench bench;
+        bench.title("SHA-256 " + std::to_string(n) + " bytes").unit("byte").batch(n);
+
+        bench.run("reference", [& data, n] {
+            ankerl::nanobench::doNotOptimizeAway(reference_digest(data.data(), n));
+        });
+
+        for (auto backend: all_backends) {
+            if (!pfs::crypto::sha256::supported(backend))
+                continue;
+
+            bench.run(backend_name(backend), [& data, n, backend] {
+                pfs::crypto::sha256 hash {backend};
+                hash.update(data.data(), n);
+                ankerl::nanobench::doNotOptimizeAway(hash.digest());
+            });
+        }
+    }
+}
+
+static std::vector<std::string> random_messages (std::size_t count)
+{
+    std::mt19937 gen {42};
+    std::uniform_int_distribution<int> size_dist {100, 500};
+    std::uniform_int_distribution<int> dist {0, 255};
+    std::vector<std::string> result;
+
+    // All sizes around block and padding boundaries
+    for (std::size_t i = 0; i < 200; i++)
+        result.emplace_back(i, static_cast<char>(i));
+
+    while (result.size() < count) {
+        std::string s(size_dist(gen), '\0');
+
+        for (auto & c: s)
+            c = static_cast<char>(dist(gen));
+
+        result.push_back(std::move(s));
+    }
+
+    return result;
+}
+
+TEST_CASE("batch") {
+    using pfs::crypto::sha256;
+    using pfs::crypto::sha256_digest;
+
+    auto messages = random_messages(1000);
+    auto batch = sha256::make_batch_context();
+
+    for (auto const & m: messages)
+        batch->add(m.data(), m.size());
+
+    auto digests = sha256::digest(*batch);
+
+    REQUIRE_EQ(digests.size(), messages.size());
+
+    for (std::size_t i = 0; i < messages.size(); i++)
+        CHECK_EQ(digests[i], reference_digest(reinterpret_cast<std::uint8_t const *>(messages[i].data()), messages[i].size()));
+
+#if PFS__X86_INTRINSICS_ENABLED
+    std::vector<sha256_digest> out(messages.size());
+
+    pfs::crypto::details::sha256_mb_digest<4>(pfs::crypto::details::sha256_mb_compress_sse2
+        , batch->messages.data(), batch->size(), out.data());
+    CHECK(out == digests);
+
+    if (pfs::cpu_features().avx2) {
+        std::fill(out.begin(), out.end(), sha256_digest{});
+        pfs::crypto::details::sha256_mb_digest<8>(pfs::crypto::details::sha256_mb_compress_avx2
+            , batch->messages.data(), batch->size(), out.data());
+        CHECK(out == digests);
+    }
+#endif
+
+    // Empty batch and single message
+    batch->clear();
+    CHECK(sha256::digest(*batch).empty());
+
+    batch->add("abc", 3);
+    CHECK_EQ(to_string(sha256::digest(*batch)[0])
+        , "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_CASE("batch benchmark") {
+    using pfs::crypto::sha256;
+    using pfs::crypto::sha256_digest;
+
+    auto messages = random_messages(10000);
+    auto batch = sha256::make_batch_context();
+    std::size_t total_size = 0;
+
+    for (auto const & m: messages) {
+        batch->add(m.data(), m.size());
+        total_size += m.size();
+    }
+
+    std::vector<sha256_digest> out(messages.size());
+
+    ankerl::nanobench::Bench bench;
+    bench.title("SHA-256 of 100-500 bytes records").unit("byte").batch(total_size);
+
+    bench.run("sequential (portable)", [&] {
+        for (std::size_t i = 0; i < messages.size(); i++) {
+            sha256 hash {sha256_backend::portable};
+            hash.update(messages[i].data(), messages[i].size());
+            out[i] = hash.digest();
+        }
+
+        ankerl::nanobench::doNotOptimizeAway(out);
+    });
+
+    bench.run("sequential (automatic)", [&] {
+        for (std::size_t i = 0; i < messages.size(); i++)
+            out[i] = sha256::digest(messages[i]);
+
+        ankerl::nanobench::doNotOptimizeAway(out);
+    });
+
+#if PFS__X86_INTRINSICS_ENABLED
+    bench.run("multi-buffer (sse2 x 4)", [&] {
+        pfs::crypto::details::sha256_mb_digest<4>(pfs::crypto::details::sha256_mb_compress_sse2
+            , batch->messages.data(), batch->size(), out.data());
+        ankerl::nanobench::doNotOptimizeAway(out);
+    });
+
+    if (pfs::cpu_features().avx2) {
+        bench.run("multi-buffer (avx2 x 8)", [&] {
+            pfs::crypto::details::sha256_mb_digest<8>(pfs::crypto::details::sha256_mb_compress_avx2
+                , batch->messages.data(), batch->size(), out.data());
+            ankerl::nanobench::doNotOptimizeAway(out);
+        });
+    }
+#endif
+
+    bench.run("batch (automatic)", [&] {
+        sha256::digest(*batch, out.data());
+        ankerl::nanobench::doNotOptimizeAway(out);
+    });
+}
+
+TEST_CASE("digest_files") {
+    namespace fs = pfs::filesystem;
+    using pfs::crypto::sha256;
+
+    auto dir = fs::temp_directory_path() / PFS__LITERAL_PATH("pfs-sha256-digest-files");
+    fs::create_directories(dir);
+
+    auto messages = random_messages(220);
+    std::vector<fs::path> paths;
+
+    for (std::size_t i = 0; i < messages.size(); i += 11) {
+        auto path = dir / fs::path{pfs::utf8_decode_path(std::to_string(i) + ".bin")};
+        std::ofstream ofs {pfs::utf8_encode_path(path), std::ios::binary};
+        ofs.write(messages[i].data(), static_cast<std::streamsize>(messages[i].size()));
+        paths.push_back(path);
+    }
+
+    paths.push_back(dir / PFS__LITERAL_PATH("nonexistent.bin"));
+
+    for (unsigned nthreads: {0u, 1u, 3u, 100u}) {
+        std::vector<std::error_code> errors;
+        auto digests = sha256::digest_files(paths, errors, nthreads);
+
+        REQUIRE_EQ(digests.size(), paths.size());
+        REQUIRE_EQ(errors.size(), paths.size());
+
+        for (std::size_t i = 0; i + 1 < paths.size(); i++) {
+            CHECK_FALSE(errors[i]);
+            CHECK_EQ(digests[i], sha256::digest(messages[i * 11]));
+        }
+
+        CHECK(errors.back());
+        CHECK_FALSE(pfs::crypto::is_valid(digests.back()));
+    }
+
+    CHECK_THROWS_AS(sha256::digest_files(paths, 2), pfs::error);
+
+    paths.pop_back();
+    CHECK_EQ(sha256::digest_files(paths, 2).size(), paths.size());
+    CHECK(sha256::digest_files(std::vector<fs::path>{}).empty());
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("tree") {
+    using pfs::crypto::sha256;
+    using pfs::crypto::sha256_digest;
+    using pfs::crypto::sha256_tree;
+
+    auto leaf = [] (std::vector<std::uint8_t> const & data, std::size_t offset, std::size_t n) {
+        std::vector<std::uint8_t> m {0x00};
+        m.insert(m.end(), data.begin() + offset, data.begin() + offset + n);
+        return sha256::digest(m.data(), m.size());
+    };
+
+    auto node = [] (sha256_digest const & left, sha256_digest const & right) {
+        std::vector<std::uint8_t> m {0x01};
+        m.insert(m.end(), left.begin(), left.end());
+        m.insert(m.end(), right.begin(), right.end());
+        return sha256::digest(m.data(), m.size());
+    };
+
+    auto bytes = random_bytes(100000);
+    auto data = reinterpret_cast<char const *>(bytes.data());
+
+    // Three leaves: ((L0, L1), L2)
+    {
+        sha256_tree tree {data, 250, 100};
+        auto l0 = leaf(bytes, 0, 100);
+        auto l1 = leaf(bytes, 100, 100);
+        auto l2 = leaf(bytes, 200, 50);
+
+        REQUIRE_EQ(tree.leaves().size(), 3);
+        CHECK_EQ(tree.leaves()[2], l2);
+        CHECK_EQ(tree.root(), node(node(l0, l1), l2));
+    }
+
+    // Single leaf and empty data
+    CHECK_EQ(sha256_tree(data, 100, 100).root(), leaf(bytes, 0, 100));
+    CHECK_EQ(sha256_tree(data, 0, 100).root(), leaf(bytes, 0, 0));
+    CHECK_EQ(sha256_tree(data, 0, 100).leaves().size(), 1);
+
+    // Result does not depend on the number of threads
+    sha256_tree tree {data, bytes.size(), 1024, 1};
+
+    for (unsigned nthreads: {0u, 3u, 1000u})
+        CHECK_EQ(sha256_tree(data, bytes.size(), 1024, nthreads).root(), tree.root());
+
+    CHECK(tree.verify(data, bytes.size()).empty());
+
+    // Modify two distant ranges
+    auto modified = bytes;
+    modified[5000] ^= 1;
+    modified[70000] ^= 1;
+    modified[71700] ^= 1;
+
+    auto mdata = reinterpret_cast<char const *>(modified.data());
+    auto expected = sha256_tree(mdata, modified.size(), 1024).root();
+
+    CHECK_EQ(tree.verify(mdata, modified.size()), std::vector<std::size_t>{4, 68, 70});
+
+    auto updated = tree;
+    updated.update(mdata, modified.size(), 5000, 1);
+    updated.update(mdata, modified.size(), 70000, 1701);
+    CHECK_EQ(updated.root(), expected);
+    CHECK(updated.verify(mdata, modified.size()).empty());
+
+    // Grow and shrink
+    auto grown = modified;
+    grown.resize(grown.size() + 3000, 0x55);
+    auto gdata = reinterpret_cast<char const *>(grown.data());
+
+    updated.update(gdata, grown.size(), modified.size(), 3000);
+    CHECK_EQ(updated.size(), grown.size());
+    CHECK_EQ(updated.root(), sha256_tree(gdata, grown.size(), 1024).root());
+
+    updated.update(mdata, 10000, 0, 0);
+    CHECK_EQ(updated.leaves().size(), 10);
+    CHECK_EQ(updated.root(), sha256_tree(mdata, 10000, 1024).root());
+
+    auto mismatches = tree.verify(data, 10000);
+    CHECK_EQ(mismatches.size(), tree.leaves().size() - 9);
+    CHECK_EQ(mismatches.front(), 9);
+
+    // File
+    namespace fs = pfs::filesystem;
+    auto path = fs::temp_directory_path() / PFS__LITERAL_PATH("pfs-sha256-tree.bin");
+
+    {
+        std::ofstream ofs {pfs::utf8_encode_path(path), std::ios::binary};
+        ofs.write(data, static_cast<std::streamsize>(bytes.size()));
+    }
+
+    CHECK_EQ(sha256_tree::build(path, 1024).root(), tree.root());
+    fs::remove(path);
+    CHECK_THROWS_AS(sha256_tree::build(path), pfs::error);
+
+    // Update of the default constructed (or failed to build) tree
+    {
+        std::error_code ec;
+        auto failed = sha256_tree::build(path, ec);
+        REQUIRE(ec);
+        CHECK(failed.leaves().empty());
+
+        failed.update(data, 0, 0, 0);
+        CHECK_EQ(failed.leaves().size(), 1);
+        CHECK_EQ(failed.root(), sha256_tree(data, 0).root());
+
+        sha256_tree empty;
+        empty.update(data, 5000, 0, 0);
+        CHECK_EQ(empty.root(), sha256_tree(data, 5000).root());
+    }
+}
@@ -5,10 +5,14 @@
 //
 // Changelog:
 //      2021.07.06 Initial version.
+//      2026.10.19 Added `split_view` tests and benchmark.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
 #include "doctest.h"
+#include "nanobench.h"
 #include "pfs/split.hpp"
+#include <random>
 #include <string>
 #include <iterator>
 #include <vector>
@@ -65,3 +69,95 @@ TEST_CASE("split") {
     }
 }
 
+
+static std::vector<std::string> split_to_vector (std::string const & source, std::string const & separator
+    , pfs::keep_empty flag)
+{
+    std::vector<std::string> result;
+    pfs::split(std::back_inserter(result), source.begin(), source.end()
+        , separator.begin(), separator.end(), flag);
+    return result;
+}
+
+static std::vector<std::string> view_to_vector (pfs::split_view const & view)
+{
+    std::vector<std::string> result;
+
+    for (auto token: view)
+        result.push_back(pfs::to_string(token));
+
+    return result;
+}
+
+TEST_CASE("split_view") {
+    using pfs::keep_empty;
+    using pfs::split_view;
+
+    std::string source {"A//B/C/"};
+
+    CHECK_EQ(view_to_vector(split_view(source, '/', keep_empty::yes))
+        , std::vector<std::string>{"A", "", "B", "C", ""});
+    CHECK_EQ(view_to_vector(split_view(source, '/', keep_empty::no))
+        , std::vector<std::string>{"A", "B", "C"});
+    CHECK_EQ(view_to_vector(split_view("a::b::::c", "::", keep_empty::yes))
+        , std::vector<std::string>{"a", "b", "", "c"});
+    CHECK(view_to_vector(split_view("", ',', keep_empty::yes)).empty());
+    CHECK(view_to_vector(split_view(",,,", ',', keep_empty::no)).empty());
+    CHECK_EQ(view_to_vector(split_view("abc", "", keep_empty::yes)), std::vector<std::string>{"abc"});
+
+    // Tokens refer to the source
+    split_view view {source, '/', keep_empty::no};
+    auto it = view.begin();
+    CHECK_EQ(it->data(), source.data());
+    CHECK_EQ((++it)->data(), source.data() + 3);
+    CHECK_EQ(std::distance(view.begin(), view.end()), 3);
+
+    // Same tokens as `split` produces
+    std::mt19937 gen {42};
+    std::string const alphabet {"ab,;"};
+
+    for (int i = 0; i < 2000; i++) {
+        std::string s(gen() % 20, '\0');
+
+        for (auto & c: s)
+            c = alphabet[gen() % alphabet.size()];
+
+        for (std::string separator: {",", ";,", ",,"}) {
+            for (auto flag: {keep_empty::yes, keep_empty::no}) {
+                CHECK_EQ(view_to_vector(split_view(s, separator, flag)), split_to_vector(s, separator, flag));
+
+                if (separator.size() == 1)
+                    CHECK_EQ(view_to_vector(split_view(s, separator[0], flag)), split_to_vector(s, separator, flag));
+            }
+        }
+    }
+}
+
+TEST_CASE("benchmark") {
+    // Log line of 4 MiB with fields of random length
+    std::mt19937 gen {42};
+    std::string line;
+
+    while (line.size() < 4 * 1024 * 1024) {
+        line.append(gen() % 16, 'x');
+        line += ' ';
+    }
+
+    std::string separator {" "};
+
+    ankerl::nanobench::Bench().batch(line.size()).unit("byte").minEpochIterations(3)
+        .run("split into std::vector<std::string>", [&] {
+            std::vector<std::string> result;
+            pfs::split(std::back_inserter(result), line.begin(), line.end()
+                , separator.begin(), separator.end(), pfs::keep_empty::yes);
+            ankerl::nanobench::doNotOptimizeAway(result);
+        })
+        .run("split_view", [&] {
+            std::size_t n = 0;
+
+            for (auto token: pfs::split_view(line, ' ', pfs::keep_empty::yes))
+                n += token.size();
+
+            ankerl::nanobench::doNotOptimizeAway(n);
+        });
+}
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/tokenizer.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<std::string> texts (pfs::tokenizer const & t)
+{
+    std::vector<std::string> result;
+
+    for (auto const & tok: t)
+        result.push_back(pfs::unescape(tok, t.options()));
+
+    return result;
+}
+
+TEST_CASE("char_set") {
+    std::mt19937 gen {42};
+
+    for (int k = 0; k < 200; k++) {
+        // Sets of different sizes (large ones are not vectorizable)
+        std::string chars;
+        auto count = 1 + gen() % (k < 100 ? 4 : 40);
+
+        for (unsigned i = 0; i < count; i++)
+            chars += static_cast<char>(gen() % 256);
+
+        pfs::char_set set {pfs::string_view{chars.data(), chars.size()}};
+        std::string s(gen() % 100, '\0');
+
+        for (auto & c: s)
+            c = static_cast<char>(gen() % 256);
+
+        std::size_t expected = s.size();
+
+        for (std::size_t i = 0; i < s.size(); i++) {
+            if (chars.find(s[i]) != std::string::npos) {
+                expected = i;
+                break;
+            }
+        }
+
+        CHECK_EQ(set.find_first_in(s.data(), s.size()), expected);
+
+        // Bit mask of the members among the 64 characters
+        std::string block(64, '\0');
+
+        for (auto & c: block)
+            c = gen() % 2 == 0 ? chars[gen() % chars.size()] : static_cast<char>(gen() % 256);
+
+        std::uint64_t expected_mask = 0;
+
+        for (std::size_t i = 0; i < block.size(); i++) {
+            if (chars.find(block[i]) != std::string::npos)
+                expected_mask |= std::uint64_t{1} << i;
+        }
+
+        CHECK_EQ(set.match(block.data(), block.size()), expected_mask);
+    }
+
+    pfs::char_set set;
+    CHECK_EQ(set.find_first_in("abc", 3), 3);
+    set.insert('\xFF');
+    CHECK(set.contains('\xFF'));
+    CHECK_EQ(set.find_first_in("abc\xFF", 4), 3);
+}
+
+TEST_CASE("tokenizer") {
+    using pfs::keep_empty;
+    using pfs::tokenizer;
+    using pfs::tokenizer_options;
+
+    // Multiple delimiters
+    CHECK_EQ(texts(tokenizer("a,b;c d", ",; ")), std::vector<std::string>{"a", "b", "c", "d"});
+    CHECK_EQ(texts(tokenizer("a,,b,", ",")), std::vector<std::string>{"a", "", "b", ""});
+    CHECK(texts(tokenizer("", ",")).empty());
+
+    tokenizer_options skip_empty;
+    skip_empty.flag = keep_empty::no;
+    CHECK_EQ(texts(tokenizer(",a,,b,", ",", skip_empty)), std::vector<std::string>{"a", "b"});
+
+    // Quotes
+    {
+        tokenizer t {"a,\"b,c\",\"d\"\"e\",\"\",\"f\ng\"\nh", ",\n"};
+        std::vector<pfs::token> tokens(t.begin(), t.end());
+
+        REQUIRE_EQ(tokens.size(), 6);
+        CHECK_EQ(tokens[1].text, pfs::string_view{"b,c"});
+        CHECK(tokens[1].quoted);
+        CHECK_FALSE(tokens[1].escaped);
+        CHECK_EQ(tokens[2].text, pfs::string_view{"d\"\"e"});
+        CHECK(tokens[2].escaped);
+        CHECK_EQ(pfs::unescape(tokens[2], t.options()), "d\"e");
+        CHECK(tokens[3].text.empty());
+        CHECK(tokens[3].quoted);
+        CHECK_EQ(tokens[4].text, pfs::string_view{"f\ng"});
+        CHECK_EQ(tokens[4].delimiter, '\n');
+        CHECK_EQ(tokens[5].text, pfs::string_view{"h"});
+        CHECK_EQ(tokens[5].delimiter, '\0');
+    }
+
+    // Empty quoted field is kept
+    CHECK_EQ(texts(tokenizer("a,\"\",", ",", skip_empty)), std::vector<std::string>{"a", ""});
+
+    // Malformed and unterminated quoted fields
+    CHECK_EQ(texts(tokenizer("\"a,b\"c,d", ",")), std::vector<std::string>{"\"a,b\"c", "d"});
+    CHECK_EQ(texts(tokenizer("a,\"b,c", ",")), std::vector<std::string>{"a", "b,c"});
+
+    // Quoting disabled
+    tokenizer_options no_quotes;
+    no_quotes.quote = '\0';
+    CHECK_EQ(texts(tokenizer("\"a,b\"", ",", no_quotes)), std::vector<std::string>{"\"a", "b\""});
+
+    // Escapes
+    tokenizer_options escapes;
+    escapes.escape = '\\';
+    CHECK_EQ(texts(tokenizer("a\\,b,c\\\\,\"d\\\"e\",f\\", ",", escapes))
+        , std::vector<std::string>{"a,b", "c\\", "d\"e", "f\\"});
+
+    // Same as split for single delimiter
+    std::mt19937 gen {42};
+    std::string const alphabet {"ab,"};
+
+    for (int i = 0; i < 1000; i++) {
+        std::string s(gen() % 20, '\0');
+
+        for (auto & c: s)
+            c = alphabet[gen() % alphabet.size()];
+
+        for (auto flag: {keep_empty::yes, keep_empty::no}) {
+            tokenizer_options opts;
+            opts.quote = '\0';
+            opts.flag = flag;
+
+            std::vector<std::string> expected;
+            std::string separator {","};
+            pfs::split(std::back_inserter(expected), s.begin(), s.end(), separator.begin(), separator.end(), flag);
+
+            CHECK_EQ(texts(tokenizer(s, ",", opts)), expected);
+        }
+    }
+}
+
+TEST_CASE("benchmark") {
+    // CSV of 8 MiB
+    std::mt19937 gen {42};
+    std::string csv;
+
+    while (csv.size() < 8 * 1024 * 1024) {
+        for (int i = 0; i < 8; i++) {
+            if (i > 0)
+                csv += ',';
+
+            if (gen() % 4 == 0) {
+                csv += '"';
+                csv.append(gen() % 24, 'q');
+                csv += ",\"";
+            } else {
+                csv.append(gen() % 24, 'x');
+            }
+        }
+
+        csv += '\n';
+    }
+
+    ankerl::nanobench::Bench().batch(csv.size()).unit("byte").minEpochIterations(3)
+        .run("tokenizer", [&] {
+            std::size_t n = 0;
+
+            for (auto const & tok: pfs::tokenizer(csv, ",\n"))
+                n += tok.text.size();
+
+            ankerl::nanobench::doNotOptimizeAway(n);
+        });
+}
@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/transcode.hpp"
+#include "pfs/unicode/utf8_iterator.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+#define UTF_SUBDIR "utf8"
+#include "unicode/test_data.hpp"
+
+namespace {
+
+// Reference decoding with utf8_iterator
+std::u32string decode (std::string const & s)
+{
+    using utf8_iterator = pfs::unicode::utf8_iterator<std::string::const_iterator>;
+
+    std::u32string result;
+
+    for (auto pos = utf8_iterator::begin(s.begin(), s.end()), end = pos.end(); pos != end; ++pos)
+        result += static_cast<char32_t>((*pos).value);
+
+    return result;
+}
+
+std::string all_texts ()
+{
+    std::string result;
+
+    for (auto const & d: data)
+        result.append(reinterpret_cast<char const *>(d.text), d.len);
+
+    return result;
+}
+
+// Results of SIMD and scalar implementations must be the same
+void check_utf16_to_utf8 (std::u16string const & s)
+{
+    std::string out1(pfs::unicode::utf8_length_from_utf16(s.data(), s.size()), '\0');
+    auto r1 = pfs::unicode::details::utf16_to_utf8_scalar(s.data(), s.size(), & out1[0]);
+
+    CHECK_EQ(pfs::unicode::details::utf8_length_from_utf16_scalar(s.data(), s.size()), out1.size());
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (pfs::cpu_features().ssse3) {
+        std::string out2(out1.size(), '\0');
+        auto r2 = pfs::unicode::details::utf16_to_utf8_ssse3(s.data(), s.size(), & out2[0]);
+
+        CHECK_EQ(r1.read, r2.read);
+        CHECK_EQ(r1.written, r2.written);
+        CHECK(r1.ec == r2.ec);
+        CHECK_EQ(out1.substr(0, r1.written), out2.substr(0, r2.written));
+    }
+#endif
+}
+
+} // namespace
+
+TEST_CASE("lengths") {
+    using namespace pfs::unicode;
+
+    auto text = all_texts();
+
+    for (std::size_t n = 0; n < 200; n++) {
+        auto s = text.substr(n * 7, n);
+        auto p = reinterpret_cast<std::uint8_t const *>(s.data());
+
+        CHECK_EQ(utf16_length_from_utf8(s.data(), s.size()), details::utf16_length_from_utf8_scalar(p, s.size()));
+        CHECK_EQ(utf32_length_from_utf8(s.data(), s.size()), details::utf32_length_from_utf8_scalar(p, s.size()));
+    }
+
+    // Long inputs overflow the lane counters unless they are flushed in time
+    {
+        auto s = text + std::string(70000, '\xF0') + std::string(70000, '\xC0');
+        auto p = reinterpret_cast<std::uint8_t const *>(s.data());
+        std::u16string u16 (140000, u'\x800');
+
+        CHECK_EQ(utf16_length_from_utf8(s.data(), s.size()), details::utf16_length_from_utf8_scalar(p, s.size()));
+        CHECK_EQ(utf32_length_from_utf8(s.data(), s.size()), details::utf32_length_from_utf8_scalar(p, s.size()));
+        CHECK_EQ(utf8_length_from_utf16(u16.data(), u16.size()), 3 * u16.size());
+        u16.append(70000, u'\xD800');
+        CHECK_EQ(utf8_length_from_utf16(u16.data(), u16.size()), 3 * 140000 + 2 * 70000);
+    }
+
+    std::u32string u32 {U"aéЖ€\U0001F600"};
+    std::u16string u16 {u"aéЖ€\U0001F600"};
+
+    CHECK_EQ(utf8_length_from_utf32(u32.data(), u32.size()), 1 + 2 + 2 + 3 + 4);
+    CHECK_EQ(utf8_length_from_utf16(u16.data(), u16.size()), 1 + 2 + 2 + 3 + 4);
+}
+
+TEST_CASE("round trip") {
+    using namespace pfs::unicode;
+
+    for (auto const & d: data) {
+        std::string s (reinterpret_cast<char const *>(d.text), d.len);
+        auto expected = decode(s);
+
+        std::u32string u32;
+        auto r = utf8_to_utf32(s, u32);
+
+        CHECK(r.ec == std::errc{});
+        CHECK_EQ(r.read, s.size());
+        CHECK_EQ(u32.size(), d.nchars);
+        CHECK(u32 == expected);
+
+        std::u16string u16;
+        r = utf8_to_utf16(s, u16);
+
+        CHECK(r.ec == std::errc{});
+        CHECK_EQ(u16.size(), utf16_length_from_utf8(s.data(), s.size()));
+
+        std::string s8;
+        r = utf16_to_utf8(u16, s8);
+        CHECK(r.ec == std::errc{});
+        CHECK_EQ(s8, s);
+        check_utf16_to_utf8(u16);
+
+        s8.clear();
+        r = utf32_to_utf8(u32, s8);
+        CHECK(r.ec == std::errc{});
+        CHECK_EQ(s8, s);
+    }
+
+    // Supplementary planes
+    std::string s {"\xF0\x9F\x98\x80 \xF0\x90\x8C\xB0"};
+    std::u16string u16;
+    utf8_to_utf16(s, u16);
+    CHECK(u16 == u"\U0001F600 \U00010330");
+
+    // Runs of ASCII and two-byte characters of the various lengths
+    for (int n = 0; n < 40; n++) {
+        std::u16string u;
+
+        for (int i = 0; i < 3 * n; i++)
+            u += static_cast<char16_t>(i % 3 == 0 ? 0x0416 : i % 5 == 0 ? 0x07FF : 'a' + i % 26);
+
+        u += u"€";
+        check_utf16_to_utf8(u);
+
+        std::string s8;
+        utf16_to_utf8(u, s8);
+
+        std::u16string back;
+        utf8_to_utf16(s8, back);
+        CHECK(back == u);
+    }
+}
+
+TEST_CASE("invalid") {
+    using namespace pfs::unicode;
+
+    {
+        std::string s = std::string(40, 'a') + "\xD0\x96\xE2\x82" + "bc";
+        std::u16string u16;
+        auto r = utf8_to_utf16(s, u16);
+
+        CHECK(r.ec == std::errc::illegal_byte_sequence);
+        CHECK_EQ(r.read, 42);
+        CHECK_EQ(r.written, 41);
+        CHECK(u16 == std::u16string(40, u'a') + u"Ж");
+    }
+
+    {
+        std::u16string s = std::u16string(20, u'a') + u"Ж";
+        s += static_cast<char16_t>(0xDC00);
+        s += u"bc";
+
+        std::string out;
+        auto r = utf16_to_utf8(s, out);
+
+        CHECK(r.ec == std::errc::illegal_byte_sequence);
+        CHECK_EQ(r.read, 21);
+        CHECK_EQ(out, std::string(20, 'a') + "\xD0\x96");
+        check_utf16_to_utf8(s);
+
+        // Unpaired high surrogate at the end
+        s = std::u16string(20, u'a');
+        s += static_cast<char16_t>(0xD800);
+        r = utf16_to_utf8(s, out);
+        CHECK(r.ec == std::errc::illegal_byte_sequence);
+        CHECK_EQ(r.read, 20);
+    }
+
+    {
+        std::u32string s = std::u32string(20, U'a');
+        s += static_cast<char32_t>(0x110000);
+
+        std::string out;
+        auto r = utf32_to_utf8(s, out);
+        CHECK(r.ec == std::errc::illegal_byte_sequence);
+        CHECK_EQ(r.read, 20);
+        CHECK_EQ(out, std::string(20, 'a'));
+
+        s[10] = static_cast<char32_t>(0xD800);
+        r = utf32_to_utf8(s, out);
+        CHECK_EQ(r.read, 10);
+    }
+
+    // Random corruption: the valid prefix is converted
+    auto text = all_texts();
+    std::mt19937 gen {42};
+
+    for (int i = 0; i < 1000; i++) {
+        auto first = std::uniform_int_distribution<std::size_t>{0, text.size() - 1}(gen);
+        auto s = text.substr(first, std::uniform_int_distribution<std::size_t>{1, 200}(gen));
+        auto pos = std::uniform_int_distribution<std::size_t>{0, s.size() - 1}(gen);
+        s[pos] = static_cast<char>(std::uniform_int_distribution<int>{0x80, 0xFF}(gen));
+
+        std::size_t error_pos = s.size();
+        utf8_validate(s, & error_pos);
+
+        std::u16string u16;
+        auto r = utf8_to_utf16(s, u16);
+        CHECK_EQ(r.read, error_pos);
+
+        std::string back;
+        utf16_to_utf8(u16, back);
+        CHECK_EQ(back, s.substr(0, error_pos));
+
+        // Random UTF-16 code units
+        std::u16string u(64, u'\0');
+
+        for (auto & c: u) {
+            auto x = std::uniform_int_distribution<int>{0, 9}(gen);
+            c = static_cast<char16_t>(x < 4 ? 'a' + x : x < 7 ? 0x400 + x
+                : std::uniform_int_distribution<int>{0, 0xFFFF}(gen));
+        }
+
+        check_utf16_to_utf8(u);
+    }
+}
+
+TEST_CASE("benchmark") {
+    using namespace pfs::unicode;
+    using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+
+    auto run = [] (char const * name, std::string const & text) {
+        std::u16string u16;
+        utf8_to_utf16(text, u16);
+
+        ankerl::nanobench::Bench bench;
+        bench.title(name).batch(text.size()).unit("byte").minEpochIterations(3);
+
+        bench.run("utf8_iterator -> UTF-16", [&] {
+            std::u16string out;
+            auto first = utf8_iterator::begin(text.data(), text.data() + text.size());
+
+            for (auto pos = first, end = first.end(); pos != end; ++pos) {
+                auto cp = (*pos).value;
+
+                if (cp < 0x10000) {
+                    out += static_cast<char16_t>(cp);
+                } else {
+                    out += static_cast<char16_t>(0xD800 | ((cp - 0x10000) >> 10));
+                    out += static_cast<char16_t>(0xDC00 | (cp & 0x3FF));
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(out);
+        }).run("utf8_to_utf16", [&] {
+            std::u16string out;
+            utf8_to_utf16(text, out);
+            ankerl::nanobench::doNotOptimizeAway(out);
+        }).run("utf8_to_utf32", [&] {
+            std::u32string out;
+            utf8_to_utf32(text, out);
+            ankerl::nanobench::doNotOptimizeAway(out);
+        }).run("utf16_to_utf8 (scalar)", [&] {
+            std::string out(utf8_length_from_utf16(u16.data(), u16.size()), '\0');
+            details::utf16_to_utf8_scalar(u16.data(), u16.size(), & out[0]);
+            ankerl::nanobench::doNotOptimizeAway(out);
+        }).run("utf16_to_utf8", [&] {
+            std::string out;
+            utf16_to_utf8(u16, out);
+            ankerl::nanobench::doNotOptimizeAway(out);
+        });
+    };
+
+    std::string ascii;
+    std::string cyrillic;
+    std::mt19937 gen {42};
+
+    while (ascii.size() < 256 * 1024) {
+        ascii += static_cast<char>(std::uniform_int_distribution<int>{0x20, 0x7E}(gen));
+
+        if (std::uniform_int_distribution<int>{0, 6}(gen) == 0)
+            cyrillic += ' ';
+        else
+            cyrillic += std::string{"абвгдежзийклмнопрстуфхцчшщьыъэюя"}.substr(2 * std::uniform_int_distribution<int>{0, 31}(gen), 2);
+    }
+
+    run("ASCII", ascii);
+    run("Cyrillic", cyrillic);
+}
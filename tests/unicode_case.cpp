@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/char.hpp"
+#include "pfs/unicode/search.hpp"
+#include "pfs/unicode/utf8_iterator.hpp"
+#include <cctype>
+#include <string>
+#include <vector>
+
+using pfs::unicode::char_t;
+using pfs::unicode::fold_case;
+using pfs::unicode::to_lower;
+using pfs::unicode::to_upper;
+
+TEST_CASE("ascii") {
+    for (int c = 0; c < 128; c++) {
+        CHECK_EQ(to_lower(char_t{c}), char_t{std::tolower(c)});
+        CHECK_EQ(to_upper(char_t{c}), char_t{std::toupper(c)});
+        CHECK_EQ(fold_case(char_t{c}), char_t{std::tolower(c)});
+    }
+}
+
+TEST_CASE("mappings") {
+    struct item { std::uint32_t c, lower, upper, fold; };
+
+    item items[] = {
+          {0x00C0, 0x00E0, 0x00C0, 0x00E0} // À
+        , {0x00E0, 0x00E0, 0x00C0, 0x00E0} // à
+        , {0x00B5, 0x00B5, 0x039C, 0x03BC} // MICRO SIGN
+        , {0x00DF, 0x00DF, 0x00DF, 0x00DF} // ß: no simple mappings
+        , {0x00FF, 0x00FF, 0x0178, 0x00FF} // ÿ
+        , {0x0130, 0x0069, 0x0130, 0x0130} // İ: folding has Turkic status only
+        , {0x017F, 0x017F, 0x0053, 0x0073} // LATIN SMALL LETTER LONG S
+        , {0x01C5, 0x01C6, 0x01C4, 0x01C6} // Titlecase Dž
+        , {0x0401, 0x0451, 0x0401, 0x0451} // Ё
+        , {0x0416, 0x0436, 0x0416, 0x0436} // Ж
+        , {0x0436, 0x0436, 0x0416, 0x0436} // ж
+        , {0x03A3, 0x03C3, 0x03A3, 0x03C3} // Σ
+        , {0x03C2, 0x03C2, 0x03A3, 0x03C3} // ς
+        , {0x0531, 0x0561, 0x0531, 0x0561} // Armenian Ա
+        , {0x10A0, 0x2D00, 0x10A0, 0x2D00} // Georgian Ⴀ
+        , {0x1E9E, 0x00DF, 0x1E9E, 0x00DF} // ẞ
+        , {0x212A, 0x006B, 0x212A, 0x006B} // KELVIN SIGN
+        , {0x0265, 0x0265, 0xA78D, 0x0265} // ɥ: delta beyond 16 bits
+        , {0xFF21, 0xFF41, 0xFF21, 0xFF41} // Fullwidth Ａ
+        , {0x10400, 0x10428, 0x10400, 0x10428} // Deseret
+        , {0x1E900, 0x1E922, 0x1E900, 0x1E922} // Adlam
+        , {0x4E2D, 0x4E2D, 0x4E2D, 0x4E2D} // CJK
+        , {0x10FFFF, 0x10FFFF, 0x10FFFF, 0x10FFFF}
+    };
+
+    for (auto const & x: items) {
+        CAPTURE(x.c);
+        CHECK_EQ(to_lower(char_t{x.c}), char_t{x.lower});
+        CHECK_EQ(to_upper(char_t{x.c}), char_t{x.upper});
+        CHECK_EQ(fold_case(char_t{x.c}), char_t{x.fold});
+    }
+
+    // Whole Cyrillic and Greek basic ranges
+    for (std::uint32_t c = 0x0410; c < 0x0430; c++) {
+        CHECK_EQ(to_lower(char_t{c}), char_t{c + 0x20});
+        CHECK_EQ(to_upper(char_t{c + 0x20}), char_t{c});
+    }
+
+    for (std::uint32_t c = 0x0391; c <= 0x03A9; c++) {
+        if (c == 0x03A2)
+            continue;
+
+        CHECK_EQ(fold_case(char_t{c}), char_t{c + 0x20});
+        CHECK_EQ(to_upper(char_t{c + 0x20}), char_t{c});
+    }
+
+    // Folding is idempotent and does not depend on the case (except dotless i that
+    // is folded only by the Turkic rules)
+    for (std::uint32_t c = 0; c <= char_t::max_code_point; c++) {
+        auto f = fold_case(char_t{c});
+
+        if (fold_case(f) != f)
+            CHECK_EQ(fold_case(f), f);
+
+        if (c != 0x0131 && fold_case(to_upper(char_t{c})) != f) {
+            CAPTURE(c);
+            CHECK_EQ(fold_case(to_upper(char_t{c})), f);
+        }
+    }
+}
+
+TEST_CASE("search") {
+    using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+
+    std::string haystack {"Κάποιος ΟΔΥΣΣΕΥΣ και οδυσσευς, Привет и ПРИВЕТ"};
+    char const * needles[] = {"Οδυσσευς", "привет"};
+
+    for (auto needle: needles) {
+        std::string n {needle};
+        int count = 0;
+
+        auto first = utf8_iterator::begin(haystack.data(), haystack.data() + haystack.size());
+        auto s_first = utf8_iterator::begin(n.data(), n.data() + n.size());
+
+        pfs::unicode::search_all(first, first.end(), s_first, s_first.end(), true
+            , [& count] (pfs::unicode::match_item const &) { count++; });
+
+        CHECK_EQ(count, 2);
+    }
+}
+
+TEST_CASE("benchmark") {
+    std::vector<char_t> text;
+
+    for (int i = 0; i < 16; i++) {
+        for (std::uint32_t c = 0x20; c < 0x7F; c++)
+            text.push_back(char_t{c});
+
+        for (std::uint32_t c = 0x0391; c < 0x03CF; c++)
+            text.push_back(char_t{c});
+
+        for (std::uint32_t c = 0x0400; c < 0x0460; c++)
+            text.push_back(char_t{c});
+    }
+
+    ankerl::nanobench::Bench().batch(text.size()).unit("char").minEpochIterations(100)
+        .run("to_lower", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto c: text)
+                sum += to_lower(c).value;
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }).run("to_upper", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto c: text)
+                sum += to_upper(c).value;
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }).run("fold_case", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto c: text)
+                sum += fold_case(c).value;
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }).run("::tolower (Latin-1 only)", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto c: text)
+                sum += c.value < 256 ? static_cast<std::uint32_t>(::tolower(static_cast<int>(c.value))) : c.value;
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
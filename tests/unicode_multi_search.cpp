@@ -0,0 +1,326 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/multi_search.hpp"
+#include "pfs/unicode/utf8_iterator.hpp"
+#include "pfs/unicode/utf16_iterator.hpp"
+#include <list>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#define UTF_SUBDIR "utf8"
+#include "unicode/test_data.hpp"
+
+using pfs::unicode::match_item;
+using pfs::unicode::multi_searcher;
+
+namespace {
+
+using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+
+struct found_item
+{
+    std::size_t id;
+    match_item m;
+
+    bool operator == (found_item const & other) const
+    {
+        return id == other.id && m.cp_first == other.m.cp_first && m.cp_last == other.m.cp_last
+            && m.cu_first == other.m.cu_first && m.cu_last == other.m.cu_last;
+    }
+
+    bool operator < (found_item const & other) const
+    {
+        return std::make_tuple(m.cp_last, -m.cp_first, id, m.cu_first, m.cu_last)
+            < std::make_tuple(other.m.cp_last, -other.m.cp_first, other.id, other.m.cu_first, other.m.cu_last);
+    }
+};
+
+std::vector<found_item> find_all (multi_searcher const & s, std::string const & haystack)
+{
+    std::vector<found_item> result;
+    auto first = utf8_iterator::begin(haystack.data(), haystack.data() + haystack.size());
+
+    s.search_all(first, first.end(), [& result] (std::size_t id, match_item const & m) {
+        result.push_back(found_item {id, m});
+    });
+
+    return result;
+}
+
+// Haystack iterated through the non-contiguous iterator
+std::vector<found_item> find_all_list (multi_searcher const & s, std::string const & haystack)
+{
+    using list_iterator = pfs::unicode::utf8_iterator<std::list<char>::const_iterator>;
+
+    std::vector<found_item> result;
+    std::list<char> l (haystack.begin(), haystack.end());
+    auto first = list_iterator::begin(l.cbegin(), l.cend());
+
+    s.search_all(first, first.end(), [& result] (std::size_t id, match_item const & m) {
+        result.push_back(found_item {id, m});
+    });
+
+    return result;
+}
+
+// Reference implementation: all (overlapping) occurrences of every needle
+std::vector<found_item> find_all_naive (std::vector<std::string> const & needles
+    , std::string const & haystack, bool ignore_case)
+{
+    struct item { std::uint32_t c; std::intmax_t cu; };
+
+    auto decode = [ignore_case] (std::string const & s) {
+        std::vector<item> result;
+        auto first = utf8_iterator::begin(s.data(), s.data() + s.size());
+
+        for (auto pos = first; pos != first.end(); ++pos) {
+            auto c = ignore_case ? pfs::unicode::fold_case(*pos) : *pos;
+            result.push_back(item {c.value, pos.base() - s.data()});
+        }
+
+        result.push_back(item {0, static_cast<std::intmax_t>(s.size())});
+        return result;
+    };
+
+    auto h = decode(haystack);
+    std::vector<found_item> result;
+
+    for (std::size_t id = 0; id < needles.size(); id++) {
+        auto n = decode(needles[id]);
+        auto m = n.size() - 1;
+
+        for (std::size_t i = 0; m > 0 && i + m < h.size(); i++) {
+            std::size_t j = 0;
+
+            while (j < m && h[i + j].c == n[j].c)
+                j++;
+
+            if (j == m) {
+                result.push_back(found_item {id, match_item {static_cast<std::intmax_t>(i)
+                    , static_cast<std::intmax_t>(i + m), h[i].cu, h[i + m].cu}});
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+} // namespace
+
+namespace doctest {
+
+template <>
+struct StringMaker<found_item>
+{
+    static String convert (found_item const & x)
+    {
+        return (std::to_string(x.id) + ":" + std::to_string(x.m.cp_first) + "-"
+            + std::to_string(x.m.cp_last) + "," + std::to_string(x.m.cu_first) + "-"
+            + std::to_string(x.m.cu_last)).c_str();
+    }
+};
+
+} // namespace doctest
+
+TEST_CASE("search") {
+    std::string haystack {"ushers: she said HIS hers; ЕЁ и её"};
+    multi_searcher s {{"he", "she", "his", "hers", "её", "", "she"}, true};
+
+    CHECK_EQ(s.size(), 7);
+
+    auto m = find_all(s, haystack);
+    std::vector<found_item> expected {
+          {1, {1, 4, 1, 4}}, {6, {1, 4, 1, 4}}, {0, {2, 4, 2, 4}}
+        , {3, {2, 6, 2, 6}}
+        , {1, {8, 11, 8, 11}}, {6, {8, 11, 8, 11}}, {0, {9, 11, 9, 11}}
+        , {2, {17, 20, 17, 20}}
+        , {0, {21, 23, 21, 23}}, {3, {21, 25, 21, 25}}
+        , {4, {27, 29, 27, 31}}, {4, {32, 34, 35, 39}}
+    };
+
+    CHECK_EQ(m, expected);
+    CHECK_EQ(find_all_list(s, haystack), expected);
+
+    auto first = utf8_iterator::begin(haystack.data(), haystack.data() + haystack.size());
+    auto r = s.search_first(first, first.end());
+    CHECK_EQ(r.first, 1);
+    CHECK_EQ(r.second.cp_first, 1);
+
+    // Case-sensitive
+    s = multi_searcher {{"HIS", "his", "Её"}, false};
+    m = find_all(s, haystack);
+    REQUIRE_EQ(m.size(), 1);
+    CHECK_EQ(m[0], found_item {0, {17, 20, 17, 20}});
+
+    // Nothing to search
+    s = multi_searcher {{}, true};
+    CHECK_EQ(find_all(s, haystack).size(), 0);
+    CHECK_EQ(s.search_first(first, first.end()).first, 0);
+
+    s = multi_searcher {{"xyz"}, true};
+    CHECK_EQ(s.search_first(first, first.end()).first, 1);
+    CHECK_EQ(s.search_first(first, first.end()).second.cp_first, -1);
+
+    // Broken needle
+    CHECK_THROWS(multi_searcher {{"a\xD0"}, true});
+}
+
+TEST_CASE("utf16 haystack") {
+    using utf16_iterator = pfs::unicode::utf16le_iterator<std::uint16_t const *>;
+
+    std::vector<std::uint16_t> haystack {'a', 0x0416, 'B', 0xD83D, 0xDE00, 0x0436, 'b'};
+    multi_searcher s {{"жb", "😀"}, true};
+    std::vector<found_item> m;
+    auto first = utf16_iterator::begin(haystack.data(), haystack.data() + haystack.size());
+
+    s.search_all(first, first.end(), [& m] (std::size_t id, match_item const & x) {
+        m.push_back(found_item {id, x});
+    });
+
+    REQUIRE_EQ(m.size(), 3);
+    CHECK_EQ(m[0], found_item {0, {1, 3, 1, 3}});
+    CHECK_EQ(m[1], found_item {1, {3, 4, 3, 5}});
+    CHECK_EQ(m[2], found_item {0, {4, 6, 5, 7}});
+}
+
+TEST_CASE("random") {
+    char const * alphabet[] = {"a", "A", "b", "B", "k", "K", "s", "S", "ж", "Ж", "σ", "ς", "Σ"
+        , "\xE2\x84\xAA", "\xC5\xBF", "ß", "ẞ", "😀", "中", " "};
+    std::mt19937 gen {42};
+
+    auto random_string = [&] (std::size_t n) {
+        std::string s;
+
+        for (std::size_t i = 0; i < n; i++)
+            s += alphabet[std::uniform_int_distribution<std::size_t>{0, sizeof(alphabet) / sizeof(alphabet[0]) - 1}(gen)];
+
+        return s;
+    };
+
+    for (int i = 0; i < 2000; i++) {
+        std::vector<std::string> needles;
+        auto count = std::uniform_int_distribution<std::size_t>{1, 20}(gen);
+
+        for (std::size_t j = 0; j < count; j++)
+            needles.push_back(random_string(std::uniform_int_distribution<std::size_t>{0, 4}(gen)));
+
+        auto haystack = random_string(std::uniform_int_distribution<std::size_t>{0, 200}(gen));
+        bool ignore_case = i % 3 != 0;
+        multi_searcher s {needles, ignore_case};
+        auto expected = find_all_naive(needles, haystack, ignore_case);
+        auto m = find_all(s, haystack);
+
+        CAPTURE(haystack);
+        std::sort(m.begin(), m.end());
+        CHECK_EQ(m, expected);
+
+        m = find_all_list(s, haystack);
+        std::sort(m.begin(), m.end());
+        CHECK_EQ(m, expected);
+    }
+}
+
+TEST_CASE("large alphabet") {
+    // Needles of many distinct CJK characters do not fit into DFA table, failure links
+    // are followed
+    std::mt19937 gen {42};
+    std::vector<std::string> needles;
+    std::string haystack;
+
+    auto random_cjk = [& gen] (std::size_t n) {
+        std::string s;
+
+        for (std::size_t i = 0; i < n; i++) {
+            auto c = std::uniform_int_distribution<std::uint32_t>{0x4E00, 0x4E00 + 3000}(gen);
+            s += static_cast<char>(0xE0 | (c >> 12));
+            s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            s += static_cast<char>(0x80 | (c & 0x3F));
+        }
+
+        return s;
+    };
+
+    for (int i = 0; i < 1000; i++)
+        needles.push_back(random_cjk(4));
+
+    for (int i = 0; i < 200; i++) {
+        haystack += random_cjk(10);
+        haystack += needles[std::uniform_int_distribution<std::size_t>{0, needles.size() - 1}(gen)];
+    }
+
+    multi_searcher s {needles, true};
+    CHECK_EQ(find_all(s, haystack), find_all_naive(needles, haystack, true));
+}
+
+TEST_CASE("benchmark") {
+    // Keywords are the words of the texts in many languages
+    std::string text;
+
+    for (auto const & d: data)
+        text.append(reinterpret_cast<char const *>(d.text), d.len);
+
+    std::mt19937 gen {42};
+    std::set<std::string> words;
+    auto first = utf8_iterator::begin(text.data(), text.data() + text.size());
+    auto word_first = first;
+
+    for (auto pos = first; pos != first.end(); ++pos) {
+        if (*pos == ' ' || *pos == '\n') {
+            auto n = std::distance(word_first, pos);
+
+            if (n >= 4 && n <= 12 && std::uniform_int_distribution<int>{0, 2}(gen) == 0)
+                words.emplace(word_first.base(), pos.base());
+
+            word_first = std::next(pos);
+        }
+
+        if (words.size() == 300)
+            break;
+    }
+
+    std::vector<std::string> needles (words.begin(), words.end());
+    std::vector<pfs::unicode::searcher> searchers;
+
+    for (auto const & n: needles) {
+        auto n_first = utf8_iterator::begin(n.data(), n.data() + n.size());
+        searchers.emplace_back(n_first, n_first.end(), true);
+    }
+
+    multi_searcher s {needles, true};
+
+    ankerl::nanobench::Bench().batch(text.size()).unit("byte").minEpochIterations(10)
+        .title(std::to_string(needles.size()) + " needles")
+        .run("multi_searcher", [&] {
+            std::size_t count = 0;
+
+            s.search_all(first, first.end(), [& count] (std::size_t, match_item const &) {
+                count++;
+            });
+
+            ankerl::nanobench::doNotOptimizeAway(count);
+        }).run("searcher per needle", [&] {
+            std::size_t count = 0;
+
+            for (auto const & x: searchers) {
+                x.search_all(first, first.end(), [& count] (match_item const &) {
+                    count++;
+                });
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(count);
+        });
+}
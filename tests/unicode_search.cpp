@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/search.hpp"
+#include "pfs/unicode/utf8_iterator.hpp"
+#include "pfs/unicode/utf16_iterator.hpp"
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+using pfs::unicode::match_item;
+using pfs::unicode::searcher;
+
+namespace {
+
+using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+
+searcher make_searcher (std::string const & needle, bool ignore_case)
+{
+    auto first = utf8_iterator::begin(needle.data(), needle.data() + needle.size());
+    return searcher{first, first.end(), ignore_case};
+}
+
+std::vector<match_item> find_all (searcher const & s, std::string const & haystack)
+{
+    std::vector<match_item> result;
+    auto first = utf8_iterator::begin(haystack.data(), haystack.data() + haystack.size());
+
+    s.search_all(first, first.end(), [& result] (match_item const & m) {
+        result.push_back(m);
+    });
+
+    return result;
+}
+
+// Haystack iterated through the non-contiguous iterator to force the decoding search
+std::vector<match_item> find_all_list (searcher const & s, std::string const & haystack)
+{
+    using list_iterator = pfs::unicode::utf8_iterator<std::list<char>::const_iterator>;
+
+    std::vector<match_item> result;
+    std::list<char> l (haystack.begin(), haystack.end());
+    auto first = list_iterator::begin(l.cbegin(), l.cend());
+
+    s.search_all(first, first.end(), [& result] (match_item const & m) {
+        result.push_back(m);
+    });
+
+    return result;
+}
+
+// Reference implementation: naive search over the folded code points
+std::vector<match_item> find_all_naive (std::string const & needle, std::string const & haystack
+    , bool ignore_case)
+{
+    struct item { std::uint32_t c; std::intmax_t cu; };
+
+    auto decode = [ignore_case] (std::string const & s) {
+        std::vector<item> result;
+        auto first = utf8_iterator::begin(s.data(), s.data() + s.size());
+
+        for (auto pos = first; pos != first.end(); ++pos) {
+            auto c = ignore_case ? pfs::unicode::fold_case(*pos) : *pos;
+            result.push_back(item {c.value, pos.base() - s.data()});
+        }
+
+        result.push_back(item {0, static_cast<std::intmax_t>(s.size())});
+        return result;
+    };
+
+    auto n = decode(needle);
+    auto h = decode(haystack);
+    auto m = n.size() - 1;
+    std::vector<match_item> result;
+
+    for (std::size_t i = 0; m > 0 && i + m < h.size(); ) {
+        std::size_t j = 0;
+
+        while (j < m && h[i + j].c == n[j].c)
+            j++;
+
+        if (j == m) {
+            result.push_back(match_item {static_cast<std::intmax_t>(i), static_cast<std::intmax_t>(i + m)
+                , h[i].cu, h[i + m].cu});
+            i += m;
+        } else {
+            i++;
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+namespace pfs {
+namespace unicode {
+
+bool operator == (match_item const & a, match_item const & b)
+{
+    return a.cp_first == b.cp_first && a.cp_last == b.cp_last
+        && a.cu_first == b.cu_first && a.cu_last == b.cu_last;
+}
+
+}} // namespace pfs::unicode
+
+namespace doctest {
+
+template <>
+struct StringMaker<match_item>
+{
+    static String convert (match_item const & m)
+    {
+        return (std::to_string(m.cp_first) + "-" + std::to_string(m.cp_last) + ","
+            + std::to_string(m.cu_first) + "-" + std::to_string(m.cu_last)).c_str();
+    }
+};
+
+} // namespace doctest
+
+TEST_CASE("search") {
+    std::string haystack {"Lorem ipsum; ЛОРЕМ ипсум; Λόρεμ ΟΔΥΣΣΕΥΣ; lorem"};
+
+    auto s = make_searcher("lorem", true);
+    auto m = find_all(s, haystack);
+    REQUIRE_EQ(m.size(), 2);
+    CHECK_EQ(m[0], match_item {0, 5, 0, 5});
+    CHECK_EQ(m[1], match_item {42, 47, 65, 70});
+    CHECK_EQ(find_all_list(s, haystack), m);
+
+    s = make_searcher("лорем", true);
+    m = find_all(s, haystack);
+    REQUIRE_EQ(m.size(), 1);
+    CHECK_EQ(m[0], match_item {13, 18, 13, 23});
+
+    // Final sigma is folded into the same character
+    s = make_searcher("οδυσσευς", true);
+    m = find_all(s, haystack);
+    REQUIRE_EQ(m.size(), 1);
+    CHECK_EQ(m[0], match_item {32, 40, 47, 63});
+
+    s = make_searcher("Lorem", false);
+    CHECK_EQ(find_all(s, haystack).size(), 1);
+
+    // Reusable for many haystacks
+    s = make_searcher("ps", true);
+    CHECK_EQ(s.search_first(utf8_iterator::begin(haystack.data(), haystack.data() + haystack.size())
+        , utf8_iterator::end(haystack.data() + haystack.size())), match_item {7, 9, 7, 9});
+
+    std::string other {"PSPS"};
+    CHECK_EQ(find_all(s, other).size(), 2);
+    CHECK_EQ(find_all(s, std::string{}).size(), 0);
+    CHECK_EQ(find_all(s, std::string{"p"}).size(), 0);
+
+    // ASCII needle must match non-ASCII characters folded into ASCII
+    s = make_searcher("kelvin", true);
+    m = find_all(s, "\xE2\x84\xAA" "elvin"); // KELVIN SIGN
+    REQUIRE_EQ(m.size(), 1);
+    CHECK_EQ(m[0], match_item {0, 6, 0, 8});
+
+    // Empty needle
+    s = make_searcher("", true);
+    CHECK_EQ(find_all(s, haystack).size(), 0);
+}
+
+TEST_CASE("utf16 haystack") {
+    using utf16_iterator = pfs::unicode::utf16le_iterator<std::uint16_t const *>;
+
+    std::vector<std::uint16_t> haystack {'a', 0x0416, 'B', 0xD83D, 0xDE00, 0x0436, 'b'};
+    auto s = make_searcher("Жb", true);
+    std::vector<match_item> m;
+    auto first = utf16_iterator::begin(haystack.data(), haystack.data() + haystack.size());
+
+    s.search_all(first, first.end(), [& m] (match_item const & x) { m.push_back(x); });
+
+    REQUIRE_EQ(m.size(), 2);
+    CHECK_EQ(m[0], match_item {1, 3, 1, 3});
+    CHECK_EQ(m[1], match_item {4, 6, 5, 7});
+}
+
+TEST_CASE("random") {
+    // Alphabet with case pairs of different kinds and lengths
+    char const * alphabet[] = {"a", "A", "b", "B", "k", "K", "s", "S", "ж", "Ж", "σ", "ς", "Σ"
+        , "\xE2\x84\xAA", "\xC5\xBF", "ß", "ẞ", "😀", " "};
+    std::mt19937 gen {42};
+
+    auto random_string = [&] (std::size_t n) {
+        std::string s;
+
+        for (std::size_t i = 0; i < n; i++)
+            s += alphabet[std::uniform_int_distribution<std::size_t>{0, sizeof(alphabet) / sizeof(alphabet[0]) - 1}(gen)];
+
+        return s;
+    };
+
+    for (int i = 0; i < 3000; i++) {
+        auto needle = random_string(std::uniform_int_distribution<std::size_t>{1, 4}(gen));
+        auto haystack = random_string(std::uniform_int_distribution<std::size_t>{0, 200}(gen));
+        bool ignore_case = i % 3 != 0;
+        auto s = make_searcher(needle, ignore_case);
+        auto expected = find_all_naive(needle, haystack, ignore_case);
+
+        CAPTURE(needle);
+        CAPTURE(haystack);
+        CHECK_EQ(find_all(s, haystack), expected);
+        CHECK_EQ(find_all_list(s, haystack), expected);
+    }
+
+    // Long needles use the dynamic window
+    for (int i = 0; i < 100; i++) {
+        auto needle = random_string(40);
+        auto haystack = random_string(100) + needle + random_string(100);
+        auto s = make_searcher(needle, true);
+        auto expected = find_all_naive(needle, haystack, true);
+
+        REQUIRE_FALSE(expected.empty());
+        CHECK_EQ(find_all(s, haystack), expected);
+        CHECK_EQ(find_all_list(s, haystack), expected);
+    }
+}
+
+TEST_CASE("benchmark") {
+    // UI filter: thousands of short strings per keystroke
+    char const * words[] = {"Lorem", "ipsum", "dolor", "sit", "amet", "Лорем", "ипсум", "долор"
+        , "Λόρεμ", "ίψουμ", "consectetur", "adipiscing", "elit", "Sed", "do", "eiusmod"};
+    std::mt19937 gen {42};
+    std::vector<std::string> items;
+    std::size_t total = 0;
+
+    for (int i = 0; i < 5000; i++) {
+        std::string s;
+
+        for (int j = 0; j < 8; j++) {
+            s += words[std::uniform_int_distribution<std::size_t>{0, sizeof(words) / sizeof(words[0]) - 1}(gen)];
+            s += ' ';
+        }
+
+        total += s.size();
+        items.push_back(std::move(s));
+    }
+
+    auto bench = [&] (char const * name, std::string const & needle) {
+        auto n_first = utf8_iterator::begin(needle.data(), needle.data() + needle.size());
+
+        ankerl::nanobench::Bench().batch(total).unit("byte").minEpochIterations(5).title(name)
+            .run("search_first (free function)", [&] {
+                int count = 0;
+
+                for (auto const & s: items) {
+                    auto first = utf8_iterator::begin(s.data(), s.data() + s.size());
+                    count += pfs::unicode::search_first(first, first.end(), n_first, n_first.end(), true).cp_first >= 0;
+                }
+
+                ankerl::nanobench::doNotOptimizeAway(count);
+            }).run("searcher::search_first", [&] {
+                int count = 0;
+                searcher srch {n_first, n_first.end(), true};
+
+                for (auto const & s: items) {
+                    auto first = utf8_iterator::begin(s.data(), s.data() + s.size());
+                    count += srch.search_first(first, first.end()).cp_first >= 0;
+                }
+
+                ankerl::nanobench::doNotOptimizeAway(count);
+            }).run("std::search + fold_case (baseline)", [&] {
+                int count = 0;
+
+                for (auto const & s: items) {
+                    auto first = utf8_iterator::begin(s.data(), s.data() + s.size());
+                    auto pos = std::search(first, first.end(), n_first, n_first.end()
+                        , [] (pfs::unicode::char_t a, pfs::unicode::char_t b) {
+                            return pfs::unicode::fold_case(a) == pfs::unicode::fold_case(b);
+                        });
+                    count += pos != first.end();
+                }
+
+                ankerl::nanobench::doNotOptimizeAway(count);
+            });
+    };
+
+    bench("ASCII needle", "ELIT");
+    bench("Cyrillic needle", "ПСУМ");
+}
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/utf8_index.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+#define UTF_SUBDIR "utf8"
+#include "unicode/test_data.hpp"
+
+using pfs::unicode::utf8_index;
+
+namespace {
+
+// Positions of the code points (octets that are not continuation ones)
+std::vector<std::size_t> code_point_offsets (std::string const & s)
+{
+    std::vector<std::size_t> result;
+
+    for (std::size_t i = 0; i < s.size(); i++) {
+        if ((static_cast<std::uint8_t>(s[i]) & 0xC0) != 0x80)
+            result.push_back(i);
+    }
+
+    return result;
+}
+
+void check_index (utf8_index const & index, std::string const & s)
+{
+    auto offsets = code_point_offsets(s);
+
+    REQUIRE_EQ(index.code_points(), offsets.size());
+    REQUIRE_EQ(index.code_units(), s.size());
+
+    for (std::size_t cp = 0; cp <= offsets.size(); cp++) {
+        auto expected = cp < offsets.size() ? offsets[cp] : s.size();
+
+        if (index.code_unit_at(s.data(), cp) != expected) {
+            CAPTURE(cp);
+            REQUIRE_EQ(index.code_unit_at(s.data(), cp), expected);
+        }
+    }
+
+    std::size_t cp = 0;
+
+    for (std::size_t cu = 0; cu <= s.size(); cu++) {
+        if (index.code_point_at(s.data(), cu) != cp) {
+            CAPTURE(cu);
+            REQUIRE_EQ(index.code_point_at(s.data(), cu), cp);
+        }
+
+        if (cp < offsets.size() && offsets[cp] == cu)
+            cp++;
+    }
+}
+
+} // namespace
+
+TEST_CASE("basic") {
+    std::string s {"aЖ€😀bcЖЖ€€😀😀defghijklmnopqrstuvwxyz"};
+
+    for (std::size_t step: {1, 2, 3, 4, 7, 64}) {
+        CAPTURE(step);
+        utf8_index index {s.data(), s.size(), step};
+        check_index(index, s);
+    }
+
+    utf8_index index {s.data(), s.size(), 4};
+
+    auto pos = index.iterator_at(s.data(), 3);
+    CHECK_EQ(*pos, pfs::unicode::char_t{0x1F600});
+    CHECK_EQ(index.iterator_at(s.data(), index.code_points()), pos.end());
+
+    // Empty text
+    utf8_index empty;
+    CHECK_EQ(empty.code_points(), 0);
+    CHECK_EQ(empty.code_unit_at("", 0), 0);
+    CHECK_EQ(empty.code_point_at("", 0), 0);
+
+    // Broken sequences are counted by the octets that are not continuation ones
+    std::string broken {"a\x80\x80\xD0z\xE2\x82"};
+    check_index(utf8_index {broken.data(), broken.size(), 2}, broken);
+}
+
+TEST_CASE("edits") {
+    char const * alphabet[] = {"a", "b", "Ж", "€", "😀", " ", "\n"};
+    std::mt19937 gen {42};
+
+    auto random_string = [&] (std::size_t n) {
+        std::string s;
+
+        for (std::size_t i = 0; i < n; i++)
+            s += alphabet[std::uniform_int_distribution<std::size_t>{0, sizeof(alphabet) / sizeof(alphabet[0]) - 1}(gen)];
+
+        return s;
+    };
+
+    for (std::size_t step: {1, 3, 8, 64}) {
+        CAPTURE(step);
+
+        auto s = random_string(300);
+        utf8_index index {s.data(), s.size(), step};
+
+        for (int i = 0; i < 300; i++) {
+            auto offsets = code_point_offsets(s);
+            offsets.push_back(s.size());
+
+            // Edit at the code point boundaries mostly, sometimes inside the sequence
+            auto any = [&] () {
+                return std::uniform_int_distribution<std::size_t>{0, s.size()}(gen);
+            };
+
+            auto boundary = [&] () {
+                return offsets[std::uniform_int_distribution<std::size_t>{0, offsets.size() - 1}(gen)];
+            };
+
+            bool raw = std::uniform_int_distribution<int>{0, 9}(gen) == 0;
+            auto a = raw ? any() : boundary();
+            auto b = raw ? any() : boundary();
+
+            if (a > b)
+                std::swap(a, b);
+
+            // Deletions of the long ranges and insertions of the long strings too
+            auto kind = std::uniform_int_distribution<int>{0, 3}(gen);
+
+            if (kind == 0)
+                b = a;
+
+            auto inserted = kind == 1 ? std::string{} : random_string(
+                std::uniform_int_distribution<std::size_t>{0, kind == 2 ? 200u : 5u}(gen));
+
+            s.replace(a, b - a, inserted);
+            index.replace(s.data(), a, b - a, inserted.size());
+
+            CAPTURE(i);
+            check_index(index, s);
+        }
+    }
+}
+
+TEST_CASE("benchmark") {
+    // Large editor buffer
+    std::string text;
+
+    while (text.size() < 4 * 1024 * 1024) {
+        for (auto const & d: data)
+            text.append(reinterpret_cast<char const *>(d.text), d.len);
+    }
+
+    using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+
+    utf8_index index {text.data(), text.size()};
+    auto first = utf8_iterator::begin(text.data(), text.data() + text.size());
+    std::mt19937 gen {42};
+    std::uniform_int_distribution<std::size_t> random_cp {0, index.code_points() - 1};
+
+    ankerl::nanobench::Bench().minEpochIterations(3).title("code point -> code unit")
+        .run("utf8_index::code_unit_at", [&] {
+            ankerl::nanobench::doNotOptimizeAway(index.code_unit_at(text.data(), random_cp(gen)));
+        }).run("utf8_iterator::advance_unsafe", [&] {
+            auto pos = first;
+            utf8_iterator::advance_unsafe(pos, static_cast<std::ptrdiff_t>(random_cp(gen)));
+            ankerl::nanobench::doNotOptimizeAway(pos.base());
+        });
+
+    // Keystroke in the middle of the buffer (the text itself is not changed to measure
+    // the index update only)
+    auto cu = index.code_unit_at(text.data(), index.code_points() / 2);
+
+    ankerl::nanobench::Bench().minEpochIterations(3).title("edit")
+        .run("utf8_index::replace", [&] {
+            index.replace(text.data(), cu, 1, 1);
+        }).run("utf8_index::assign", [&] {
+            index.assign(text.data(), text.size());
+        });
+
+    CHECK_EQ(index.code_units(), text.size());
+}
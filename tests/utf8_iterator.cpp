@@ -5,6 +5,7 @@
 //
 // Changelog:
 //      2023.04.13 Initial version.
+//      2026.10.19 Search across non-latin characters does not depend on ICU.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
@@ -170,7 +171,6 @@ TEST_CASE("search") {
         CHECK_MESSAGE(count == 5, "Wrong number of occurances");
     }
 
-#if PFS__ICU_ENABLED
     {
         char const * haystack = "Лорем ипсум долор сит амет. Вис лорем."
             " Хис ан ЛоРеМ, куад алтера лореМ. Еи хас ЛОРЕМ.";
@@ -230,7 +230,6 @@ TEST_CASE("search") {
 
         CHECK_MESSAGE(count == 5, "Wrong number of occurances");
     }
-#endif
 
     {
         using char_t = pfs::unicode::char_t;
@@ -246,7 +245,6 @@ TEST_CASE("search") {
         CHECK(pos != last);
     }
 
-#if PFS__ICU_ENABLED
     {
         char const * haystack = "<span Лорем>Лорем</Лорем span> ипсум долор сит амет. "
             "<p лорем>Вис лорем.</p лорем>"
@@ -308,7 +306,4 @@ TEST_CASE("search") {
 
         CHECK_MESSAGE(count == 5, "Wrong number of occurances");
     }
-#else
-    MESSAGE("ICU disabled. Search test across non-latin character sequence deactivated");
-#endif
 }
@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/utf8_iterator.hpp"
+#include "pfs/unicode/utf8_validate.hpp"
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#define UTF_SUBDIR "utf8"
+#include "unicode/test_data.hpp"
+
+namespace {
+
+// Valid prefix length of all available implementations must be the same
+std::size_t valid_prefix (std::string const & s)
+{
+    auto p = reinterpret_cast<std::uint8_t const *>(s.data());
+    auto result = pfs::unicode::details::utf8_valid_prefix_scalar(p, p + s.size());
+
+#if PFS__X86_INTRINSICS_ENABLED
+    if (pfs::cpu_features().ssse3)
+        CHECK_EQ(pfs::unicode::details::utf8_valid_prefix_ssse3(p, s.size()), result);
+
+    if (pfs::cpu_features().avx2)
+        CHECK_EQ(pfs::unicode::details::utf8_valid_prefix_avx2(p, s.size()), result);
+#endif
+
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("validate") {
+    using pfs::unicode::utf8_validate;
+
+    CHECK(utf8_validate(std::string{}));
+    CHECK(utf8_validate(std::string{"Hello"}));
+    CHECK(utf8_validate(std::string{"АБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЬЫЪЭЮЯ"}));
+    CHECK(utf8_validate(std::string{"\xF0\x90\x8C\xB0\xF4\x8F\xBF\xBF\xEF\xBF\xBF\xE0\xA0\x80\xC2\x80"}));
+
+    // Invalid sequences
+    char const * invalid[] = {
+          "\x80"                // Stray continuation
+        , "\xBF"
+        , "\xC0\x80"            // Overlong
+        , "\xC1\xBF"
+        , "\xE0\x80\x80"
+        , "\xE0\x9F\xBF"
+        , "\xF0\x80\x80\x80"
+        , "\xF0\x8F\xBF\xBF"
+        , "\xED\xA0\x80"        // Surrogates
+        , "\xED\xBF\xBF"
+        , "\xF4\x90\x80\x80"    // Above U+10FFFF
+        , "\xF5\x80\x80\x80"
+        , "\xF8\x88\x80\x80\x80" // Five and six bytes sequences
+        , "\xFC\x84\x80\x80\x80\x80"
+        , "\xFE"
+        , "\xFF"
+        , "\xC2"                // Incomplete
+        , "\xE1\x80"
+        , "\xF1\x80\x80"
+        , "\xC2\x41"            // Missing continuation
+        , "\xE1\x80\x41"
+        , "\xF1\x80\x80\x41"
+        , "\xC2\x80\x80"        // Too long
+    };
+
+    for (auto seq: invalid) {
+        std::string s {seq};
+        auto expected_pos = std::string{seq} == "\xC2\x80\x80" ? std::size_t{2} : std::size_t{0};
+
+        // Place the sequence at the various offsets to cross the block boundaries
+        for (std::size_t offset = 0; offset < 70; offset++) {
+            std::string text = std::string(offset, 'a') + s + std::string(offset % 7, 'z');
+            std::size_t pos = 0;
+
+            CHECK_FALSE(utf8_validate(text, & pos));
+            CHECK_EQ(pos, offset + expected_pos);
+            CHECK_EQ(valid_prefix(text), offset + expected_pos);
+
+            // Non-ASCII prefix
+            text = std::string{"Ж"} + std::string(offset, 'a') + s;
+            CHECK_EQ(valid_prefix(text), 2 + offset + expected_pos);
+        }
+    }
+
+    // Non-contiguous iterators
+    {
+        std::string s {"abc\xD0\x96\xE2\x82"};
+        std::list<char> l (s.begin(), s.end());
+        std::size_t pos = 0;
+
+        CHECK_FALSE(utf8_validate(l.begin(), l.end(), & pos));
+        CHECK_EQ(pos, 5);
+
+        l.pop_back();
+        l.pop_back();
+        CHECK(utf8_validate(l.begin(), l.end()));
+    }
+}
+
+TEST_CASE("validate texts") {
+    using pfs::unicode::utf8_validate;
+
+    std::string all;
+
+    for (auto const & d: data) {
+        std::string text (reinterpret_cast<char const *>(d.text), d.len);
+        CHECK(utf8_validate(text));
+        CHECK_EQ(valid_prefix(text), text.size());
+        all += text;
+    }
+
+    // Random corruption of the valid text, SIMD and scalar results must match
+    std::mt19937 gen {42};
+
+    for (int i = 0; i < 2000; i++) {
+        auto first = std::uniform_int_distribution<std::size_t>{0, all.size() - 1}(gen);
+        auto size = std::uniform_int_distribution<std::size_t>{1, 300}(gen);
+        auto text = all.substr(first, size);
+        auto n = std::uniform_int_distribution<int>{0, 3}(gen);
+
+        for (int j = 0; j < n; j++) {
+            auto pos = std::uniform_int_distribution<std::size_t>{0, text.size() - 1}(gen);
+            text[pos] = static_cast<char>(std::uniform_int_distribution<int>{0, 255}(gen));
+        }
+
+        std::size_t pos = text.size();
+        bool valid = utf8_validate(text, & pos);
+
+        CHECK_EQ(valid_prefix(text), pos);
+        CHECK_EQ(valid, pos == text.size());
+    }
+}
+
+TEST_CASE("iterator") {
+    using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+    using utf8_unchecked_iterator = pfs::unicode::utf8_unchecked_iterator<char const *>;
+
+    for (auto const & d: data) {
+        auto first = reinterpret_cast<char const *>(d.text);
+        auto last = first + d.len;
+
+        REQUIRE(pfs::unicode::utf8_validate(first, last));
+
+        auto pos = utf8_iterator::begin(first, last);
+        auto upos = utf8_unchecked_iterator::begin(first, last);
+        auto end = pos.end();
+        unsigned int count = 0;
+
+        for (; pos != end; ++pos, ++upos, ++count)
+            CHECK_EQ(*pos, *upos);
+
+        CHECK_EQ(upos.base(), end.base());
+        CHECK_EQ(count, d.nchars);
+
+        auto res = utf8_iterator::distance_unsafe(utf8_iterator::begin(first, last), end);
+        CHECK_EQ(res.first, d.nchars);
+        CHECK_EQ(res.second, d.len);
+    }
+
+    // ASCII runs of the various lengths
+    for (int n = 0; n < 80; n++) {
+        std::string s = std::string(n, 'a') + "Ж" + std::string(n, 'b') + "€";
+
+        auto pos = utf8_iterator::begin(s.data(), s.data() + s.size());
+        auto res = utf8_iterator::distance_unsafe(pos, pos.end());
+
+        CHECK_EQ(res.first, 2 * n + 2);
+        CHECK_EQ(res.second, 2 * n + 5);
+        CHECK_EQ(std::distance(pos, pos.end()), 2 * n + 2);
+
+        auto p = pos;
+        std::advance(p, n);
+        CHECK_EQ(*p, pfs::unicode::char_t{0x0416});
+        std::advance(p, n + 1);
+        CHECK_EQ(*p, pfs::unicode::char_t{0x20AC});
+
+        p = pos;
+        utf8_iterator::advance_unsafe(p, n + 1);
+        CHECK_EQ(*p, n > 0 ? pfs::unicode::char_t{'b'} : pfs::unicode::char_t{0x20AC});
+    }
+}
+
+TEST_CASE("benchmark") {
+    using utf8_iterator = pfs::unicode::utf8_iterator<char const *>;
+    using utf8_unchecked_iterator = pfs::unicode::utf8_unchecked_iterator<char const *>;
+
+    // ASCII text with rare multi-byte characters
+    std::string text;
+    std::mt19937 gen {42};
+
+    while (text.size() < 1024 * 1024) {
+        if (std::uniform_int_distribution<int>{0, 99}(gen) < 2)
+            text += "Жё€";
+        else
+            text += static_cast<char>(std::uniform_int_distribution<int>{0x20, 0x7E}(gen));
+    }
+
+    auto first = text.data();
+    auto last = first + text.size();
+
+    ankerl::nanobench::Bench().batch(text.size()).unit("byte").minEpochIterations(3)
+        .run("utf8_validate (scalar)", [&] {
+            auto n = pfs::unicode::details::utf8_valid_prefix_scalar(first, last);
+            ankerl::nanobench::doNotOptimizeAway(n);
+        }).run("utf8_validate", [&] {
+            auto valid = pfs::unicode::utf8_validate(first, last);
+            ankerl::nanobench::doNotOptimizeAway(valid);
+        }).run("distance_unsafe", [&] {
+            auto pos = utf8_iterator::begin(first, last);
+            auto n = utf8_iterator::distance_unsafe(pos, pos.end());
+            ankerl::nanobench::doNotOptimizeAway(n);
+        }).run("advance_unsafe", [&] {
+            auto pos = utf8_iterator::begin(first, last);
+            utf8_iterator::advance_unsafe(pos, 900000);
+            ankerl::nanobench::doNotOptimizeAway(pos);
+        }).run("decode", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto pos = utf8_iterator::begin(first, last), end = pos.end(); pos != end; ++pos)
+                sum += (*pos).value;
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }).run("decode (unchecked)", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto pos = utf8_unchecked_iterator::begin(first, last), end = pos.end(); pos != end; ++pos)
+                sum += (*pos).value;
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}
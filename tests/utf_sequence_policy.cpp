@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `common-lib`.
+//
+// Changelog:
+//      2026.10.19 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include "doctest.h"
+#include "nanobench.h"
+#include "pfs/unicode/utf8_iterator.hpp"
+#include "pfs/unicode/utf16_iterator.hpp"
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#define UTF_SUBDIR "utf8"
+#include "unicode/test_data.hpp"
+
+using pfs::unicode::char_t;
+using pfs::unicode::except_broken_sequence;
+using pfs::unicode::replace_broken_sequence;
+using pfs::unicode::stop_broken_sequence;
+
+namespace {
+
+template <typename Policy, typename It>
+std::vector<std::uint32_t> decode_utf8 (It first, It last, bool * broken = nullptr)
+{
+    std::vector<std::uint32_t> result;
+    auto pos = pfs::unicode::utf8_iterator<It, Policy>::begin(first, last);
+    auto end = pos.end();
+
+    for (; pos != end; ++pos)
+        result.push_back((*pos).value);
+
+    if (broken != nullptr)
+        *broken = pos.broken();
+
+    return result;
+}
+
+template <typename Policy>
+std::vector<std::uint32_t> decode_utf8 (std::string const & s, bool * broken = nullptr)
+{
+    return decode_utf8<Policy>(s.data(), s.data() + s.size(), broken);
+}
+
+template <typename Policy>
+std::vector<std::uint32_t> decode_utf16 (std::vector<std::uint16_t> const & s, bool * broken = nullptr)
+{
+    using iterator = pfs::unicode::utf16_iterator<std::uint16_t const *, pfs::unicode::utf16le_byteswap, Policy>;
+
+    std::vector<std::uint32_t> result;
+    auto pos = iterator::begin(s.data(), s.data() + s.size());
+    auto end = pos.end();
+
+    for (; pos != end; ++pos)
+        result.push_back((*pos).value);
+
+    if (broken != nullptr)
+        *broken = pos.broken();
+
+    return result;
+}
+
+std::vector<std::uint32_t> codes (std::initializer_list<std::uint32_t> l)
+{
+    return std::vector<std::uint32_t>(l);
+}
+
+} // namespace
+
+TEST_CASE("utf8 replace") {
+    bool broken = true;
+
+    CHECK_EQ(decode_utf8<replace_broken_sequence>("a\xD0\x96z", & broken), codes({'a', 0x0416, 'z'}));
+    CHECK_FALSE(broken);
+
+    // Invalid leading octet
+    CHECK_EQ(decode_utf8<replace_broken_sequence>("a\x80z", & broken), codes({'a', 0xFFFD, 'z'}));
+    CHECK(broken);
+    CHECK_EQ(decode_utf8<replace_broken_sequence>("\xFF\xFE"), codes({0xFFFD, 0xFFFD}));
+
+    // Missing continuation: the octet that breaks the sequence starts the next one
+    CHECK_EQ(decode_utf8<replace_broken_sequence>("\xD0z"), codes({0xFFFD, 'z'}));
+    CHECK_EQ(decode_utf8<replace_broken_sequence>("\xE2\x82\xD0\x96"), codes({0xFFFD, 0x0416}));
+
+    // Truncated at the end
+    CHECK_EQ(decode_utf8<replace_broken_sequence>("ab\xE2\x82", & broken), codes({'a', 'b', 0xFFFD}));
+    CHECK(broken);
+
+    // Non-contiguous iterator
+    std::string s {"\xD0\x96\xD0\xE2\x82\xAC"};
+    std::list<char> l (s.begin(), s.end());
+    CHECK_EQ(decode_utf8<replace_broken_sequence>(l.begin(), l.end()), codes({0x0416, 0xFFFD, 0x20AC}));
+}
+
+TEST_CASE("utf8 stop") {
+    bool broken = true;
+
+    CHECK_EQ(decode_utf8<stop_broken_sequence>("abc", & broken), codes({'a', 'b', 'c'}));
+    CHECK_FALSE(broken);
+
+    CHECK_EQ(decode_utf8<stop_broken_sequence>("ab\x80z", & broken), codes({'a', 'b', 0xFFFD}));
+    CHECK(broken);
+
+    CHECK_EQ(decode_utf8<stop_broken_sequence>("\xD0z\xD0\x96", & broken), codes({0xFFFD}));
+    CHECK(broken);
+
+    // Advancing through the broken sequence stops at the end too
+    {
+        std::string s {"ab\xFFxyz"};
+        auto pos = pfs::unicode::utf8_iterator<char const *, stop_broken_sequence>::begin(s.data(), s.data() + s.size());
+
+        std::advance(pos, 3);
+        CHECK_EQ(pos, pos.end());
+        CHECK(pos.broken());
+    }
+
+    // Throwing policy is the default one
+    CHECK_THROWS(decode_utf8<except_broken_sequence>("ab\x80z"));
+    CHECK_THROWS(decode_utf8<except_broken_sequence>("\xD0z"));
+}
+
+TEST_CASE("utf8 skip and distance") {
+    using utf8_iterator = pfs::unicode::utf8_iterator<char const *, replace_broken_sequence>;
+
+    std::string s {"a\x80\xD0\x96z"};
+    auto pos = utf8_iterator::begin(s.data(), s.data() + s.size());
+
+    auto res = utf8_iterator::distance_unsafe(pos, pos.end());
+    CHECK_EQ(res.first, 4);
+    CHECK_EQ(res.second, 5);
+    CHECK_EQ(std::distance(pos, pos.end()), 4);
+
+    utf8_iterator::advance_unsafe(pos, 2);
+    CHECK_EQ(*pos, char_t{0x0416});
+    CHECK(pos.broken());
+
+    CHECK_THROWS(pfs::unicode::utf8_iterator<char const *>::distance_unsafe(
+        pfs::unicode::utf8_iterator<char const *>::begin(s.data(), s.data() + s.size())
+        , pfs::unicode::utf8_iterator<char const *>::end(s.data() + s.size())));
+}
+
+TEST_CASE("utf16") {
+    bool broken = true;
+
+    std::vector<std::uint16_t> valid {'a', 0xD83D, 0xDE00, 'z'};
+    CHECK_EQ(decode_utf16<replace_broken_sequence>(valid, & broken), codes({'a', 0x1F600, 'z'}));
+    CHECK_FALSE(broken);
+
+    // Lone low surrogate
+    std::vector<std::uint16_t> low {'a', 0xDE00, 'z'};
+    CHECK_EQ(decode_utf16<replace_broken_sequence>(low, & broken), codes({'a', 0xFFFD, 'z'}));
+    CHECK(broken);
+    CHECK_EQ(decode_utf16<stop_broken_sequence>(low, & broken), codes({'a', 0xFFFD}));
+    CHECK(broken);
+    CHECK_THROWS(decode_utf16<except_broken_sequence>(low));
+
+    // High surrogate not followed by the low one, the unit starts the next character
+    std::vector<std::uint16_t> high {0xD83D, 'z', 0xD83D};
+    CHECK_EQ(decode_utf16<replace_broken_sequence>(high), codes({0xFFFD, 'z', 0xFFFD}));
+    CHECK_EQ(decode_utf16<stop_broken_sequence>(high), codes({0xFFFD}));
+    CHECK_THROWS(decode_utf16<except_broken_sequence>(high));
+}
+
+TEST_CASE("dirty texts") {
+    // Replacing policy must give the same characters as the throwing one for valid input,
+    // and must never throw for the corrupted one
+    std::mt19937 gen {42};
+
+    for (auto const & d: data) {
+        std::string text (reinterpret_cast<char const *>(d.text), d.len);
+
+        CHECK_EQ(decode_utf8<replace_broken_sequence>(text), decode_utf8<except_broken_sequence>(text));
+
+        for (int i = 0; i < 50; i++) {
+            auto dirty = text;
+            auto pos = std::uniform_int_distribution<std::size_t>{0, dirty.size() - 1}(gen);
+            dirty[pos] = static_cast<char>(std::uniform_int_distribution<int>{0x80, 0xFF}(gen));
+
+            bool broken = false;
+            bool stop_broken = false;
+            std::vector<std::uint32_t> replaced;
+            std::vector<std::uint32_t> stopped;
+
+            CHECK_NOTHROW(replaced = decode_utf8<replace_broken_sequence>(dirty, & broken));
+            CHECK_NOTHROW(stopped = decode_utf8<stop_broken_sequence>(dirty, & stop_broken));
+            CHECK_EQ(broken, stop_broken);
+
+            // Stopped sequence is the prefix of the replaced one
+            REQUIRE(stopped.size() <= replaced.size());
+            CHECK(std::equal(stopped.begin(), stopped.end(), replaced.begin()));
+
+            if (broken)
+                CHECK_EQ(stopped.back(), std::uint32_t{char_t::replacement_char});
+            else
+                CHECK_EQ(replaced, stopped);
+        }
+    }
+}
+
+TEST_CASE("benchmark") {
+    // Corpus of short records, a few percent of them contain invalid octets
+    std::string all;
+
+    for (auto const & d: data)
+        all.append(reinterpret_cast<char const *>(d.text), d.len);
+
+    std::mt19937 gen {42};
+    std::vector<std::string> records;
+    std::size_t total = 0;
+
+    while (total < 1024 * 1024) {
+        auto first = std::uniform_int_distribution<std::size_t>{0, all.size() - 200}(gen);
+        auto r = all.substr(first, 160);
+
+        if (std::uniform_int_distribution<int>{0, 99}(gen) < 3)
+            r[std::uniform_int_distribution<std::size_t>{0, r.size() - 1}(gen)] = '\xFF';
+
+        total += r.size();
+        records.push_back(std::move(r));
+    }
+
+    ankerl::nanobench::Bench().batch(total).unit("byte").minEpochIterations(3)
+        .run("except_broken_sequence", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto const & r: records) {
+                try {
+                    auto first = r.data();
+                    auto pos = pfs::unicode::utf8_iterator<char const *>::begin(first, first + r.size());
+
+                    for (auto end = pos.end(); pos != end; ++pos)
+                        sum += (*pos).value;
+                } catch (pfs::error const &) {
+                    sum++;
+                }
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }).run("replace_broken_sequence", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto const & r: records) {
+                auto first = r.data();
+                auto pos = pfs::unicode::utf8_iterator<char const *, replace_broken_sequence>::begin(first, first + r.size());
+
+                for (auto end = pos.end(); pos != end; ++pos)
+                    sum += (*pos).value;
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        }).run("stop_broken_sequence", [&] {
+            std::uint32_t sum = 0;
+
+            for (auto const & r: records) {
+                auto first = r.data();
+                auto pos = pfs::unicode::utf8_iterator<char const *, stop_broken_sequence>::begin(first, first + r.size());
+
+                for (auto end = pos.end(); pos != end; ++pos)
+                    sum += (*pos).value;
+
+                sum += pos.broken();
+            }
+
+            ankerl::nanobench::doNotOptimizeAway(sum);
+        });
+}